@@ -10,7 +10,6 @@
 #include <list>
 #include <map>
 #include <mutex>
-#include <set>
 #include <vector>
 
 namespace ChimeraTK {
@@ -78,6 +77,12 @@ namespace ChimeraTK {
 
     VersionNumber triggerInterrupt(uint32_t interruptNumber) override;
 
+    /** Simulate that the driver has coalesced interrupts, i.e. nMissed interrupts have occurred in addition to the
+     *  next one triggered with triggerInterrupt(). This is reported to the async::Domain like a real backend does. Does
+     *  nothing if there is no async::Domain for the interrupt number.
+     */
+    void reportMissedInterrupts(uint32_t interruptNumber, uint64_t nMissed);
+
    protected:
     struct AddressRange {
       const uint64_t offset;
@@ -101,12 +106,55 @@ namespace ChimeraTK {
     std::string _mapFile;
 
     std::map<uint64_t, std::vector<int32_t>> _barContents;
-    std::set<std::pair<uint64_t, uint64_t>> _readOnlyAddresses; // bar/address combinations which are read only
-    std::multimap<AddressRange, boost::function<void(void)>> _writeCallbackFunctions;
     std::mutex mutex;
 
+    /// A write callback function together with the range of words it is registered for (end is exclusive).
+    struct WriteCallback {
+      uint64_t beginWord;
+      uint64_t endWord;
+      boost::function<void(void)> function;
+    };
+
+    /**
+     * Lookup information for one bar, used by read() and write(). The contents pointer refers to the vector in
+     * _barContents, which is stable since elements of a std::map are never moved. It is nullptr if the bar is not
+     * defined in the map file.
+     */
+    struct Bar {
+      std::vector<int32_t>* contents{nullptr};
+
+      /// one bit per word, set if the word is read only
+      std::vector<bool> readOnly;
+      size_t nReadOnlyWords{0};
+
+      /// Write callback functions sorted by beginWord. maxEndWord[i] is the maximum endWord of writeCallbacks[0] to
+      /// writeCallbacks[i], so the search for overlapping callbacks can stop early.
+      std::vector<WriteCallback> writeCallbacks;
+      std::vector<uint64_t> maxEndWord;
+    };
+
+    /// Lookup information for all bars, keyed by the bar number
+    std::map<uint64_t, Bar> _bars;
+
+    /// Direct lookup table into _bars for bar numbers below MAX_DIRECT_BAR_INDEX, nullptr for unknown bars
+    std::vector<Bar*> _barTable;
+    static constexpr uint64_t MAX_DIRECT_BAR_INDEX{64};
+
     void resizeBarContents();
 
+    /// Find the lookup information for the given bar. Returns nullptr if it does not exist.
+    Bar* findBar(uint64_t bar);
+    const Bar* findBar(uint64_t bar) const;
+
+    /// Find or create the lookup information for the given bar. The caller must hold the mutex.
+    Bar& getOrCreateBar(uint64_t bar);
+
+    /// Return a pointer to the word at the given address. Throws a logic_error if the given range is outside the bar.
+    int32_t* getCheckedWordPointer(uint64_t bar, uint64_t address, size_t sizeInBytes);
+
+    /// Returns true if at least one word in the range [beginWord, endWord) of the given bar is not read-only.
+    static bool containsWritableWord(const Bar& bar, uint64_t beginWord, uint64_t endWord);
+
     void runWriteCallbackFunctionsForAddressRange(AddressRange addressRange);
     std::list<boost::function<void(void)>> findCallbackFunctionsForAddressRange(AddressRange addressRange);
 
@@ -9,8 +9,10 @@
 #include <boost/lambda/lambda.hpp>
 
 #include <algorithm>
+#include <cstring>
 #include <regex>
 #include <sstream>
+#include <utility>
 
 namespace ChimeraTK {
 
@@ -33,9 +35,46 @@ namespace ChimeraTK {
       // the size of the vector is in words, not in bytes -> convert fist with rounding up
       auto nwords = (barSizesInByte.second + sizeof(int32_t) - 1) / sizeof(int32_t);
       _barContents[barSizesInByte.first].resize(nwords, 0);
+      auto& barInfo = getOrCreateBar(barSizesInByte.first);
+      barInfo.contents = &_barContents[barSizesInByte.first];
+      barInfo.readOnly.resize(std::max(barInfo.readOnly.size(), nwords), false);
     }
   }
 
+  DummyBackend::Bar& DummyBackend::getOrCreateBar(uint64_t bar) {
+    auto [it, isNew] = _bars.try_emplace(bar);
+    if(isNew && bar < MAX_DIRECT_BAR_INDEX) {
+      if(_barTable.size() <= bar) {
+        _barTable.resize(bar + 1, nullptr);
+      }
+      _barTable[bar] = &it->second;
+    }
+    return it->second;
+  }
+
+  const DummyBackend::Bar* DummyBackend::findBar(uint64_t bar) const {
+    if(bar < MAX_DIRECT_BAR_INDEX) {
+      return bar < _barTable.size() ? _barTable[bar] : nullptr;
+    }
+    auto it = _bars.find(bar);
+    return it != _bars.end() ? &it->second : nullptr;
+  }
+
+  DummyBackend::Bar* DummyBackend::findBar(uint64_t bar) {
+    return const_cast<Bar*>(std::as_const(*this).findBar(bar));
+  }
+
+  int32_t* DummyBackend::getCheckedWordPointer(uint64_t bar, uint64_t address, size_t sizeInBytes) {
+    auto* barInfo = findBar(bar);
+    uint64_t wordBaseIndex = address / sizeof(int32_t);
+    uint64_t nWords = sizeInBytes / sizeof(int32_t);
+    if(!barInfo || !barInfo->contents || wordBaseIndex + nWords > barInfo->contents->size()) {
+      throw ChimeraTK::logic_error("Invalid address offset " + std::to_string(address) + " with size " +
+          std::to_string(sizeInBytes) + " in bar " + std::to_string(bar) + ".");
+    }
+    return barInfo->contents->data() + wordBaseIndex;
+  }
+
   void DummyBackend::closeImpl() {
     std::lock_guard<std::mutex> lock(mutex);
 
@@ -44,7 +83,7 @@ namespace ChimeraTK {
 
   void DummyBackend::writeRegisterWithoutCallback(uint64_t bar, uint64_t address, int32_t data) {
     std::lock_guard<std::mutex> lock(mutex);
-    TRY_REGISTER_ACCESS(_barContents[bar].at(address / sizeof(int32_t)) = data;);
+    *getCheckedWordPointer(bar, address, sizeof(int32_t)) = data;
   }
 
   void DummyBackend::read(uint64_t bar, uint64_t address, int32_t* data, size_t sizeInBytes) {
@@ -53,9 +92,7 @@ namespace ChimeraTK {
       assert(_opened);
       checkActiveException();
       checkSizeIsMultipleOfWordSize(sizeInBytes);
-      unsigned int wordBaseIndex = address / sizeof(int32_t);
-      TRY_REGISTER_ACCESS(for(unsigned int wordIndex = 0; wordIndex < sizeInBytes / sizeof(int32_t);
-          ++wordIndex) { data[wordIndex] = _barContents[bar].at(wordBaseIndex + wordIndex); });
+      std::memcpy(data, getCheckedWordPointer(bar, address, sizeInBytes), sizeInBytes);
     }
   }
 
@@ -65,13 +102,20 @@ namespace ChimeraTK {
       assert(_opened);
       checkActiveException();
       checkSizeIsMultipleOfWordSize(sizeInBytes);
-      uint64_t wordBaseIndex = address / sizeof(int32_t);
-      TRY_REGISTER_ACCESS(for(unsigned int wordIndex = 0; wordIndex < sizeInBytes / sizeof(int32_t); ++wordIndex) {
-        if(isReadOnly(bar, address + wordIndex * sizeof(int32_t))) {
-          continue;
+      auto* target = getCheckedWordPointer(bar, address, sizeInBytes);
+      const auto& barInfo = *findBar(bar);
+      if(barInfo.nReadOnlyWords == 0) {
+        std::memcpy(target, data, sizeInBytes);
+      }
+      else {
+        // skip read-only words
+        uint64_t wordBaseIndex = address / sizeof(int32_t);
+        for(size_t wordIndex = 0; wordIndex < sizeInBytes / sizeof(int32_t); ++wordIndex) {
+          if(!barInfo.readOnly[wordBaseIndex + wordIndex]) {
+            target[wordIndex] = data[wordIndex];
+          }
         }
-        _barContents[bar].at(wordBaseIndex + wordIndex) = data[wordIndex];
-      })
+      }
     }
     // we call the callback functions after releasing the mutex in order to
     // avoid the risk of deadlocks.
@@ -85,8 +129,17 @@ namespace ChimeraTK {
   }
 
   void DummyBackend::setReadOnly(uint64_t bar, uint64_t address, size_t sizeInWords) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& barInfo = getOrCreateBar(bar);
+    uint64_t wordBaseIndex = address / sizeof(int32_t);
+    if(barInfo.readOnly.size() < wordBaseIndex + sizeInWords) {
+      barInfo.readOnly.resize(wordBaseIndex + sizeInWords, false);
+    }
     for(size_t i = 0; i < sizeInWords; ++i) {
-      _readOnlyAddresses.insert({bar, address + i * sizeof(int32_t)});
+      if(!barInfo.readOnly[wordBaseIndex + i]) {
+        barInfo.readOnly[wordBaseIndex + i] = true;
+        ++barInfo.nReadOnlyWords;
+      }
     }
   }
 
@@ -95,13 +148,41 @@ namespace ChimeraTK {
   }
 
   bool DummyBackend::isReadOnly(uint64_t bar, uint64_t address) const {
-    return (_readOnlyAddresses.find({bar, address}) != _readOnlyAddresses.end());
+    const auto* barInfo = findBar(bar);
+    uint64_t wordIndex = address / sizeof(int32_t);
+    return barInfo && wordIndex < barInfo->readOnly.size() && barInfo->readOnly[wordIndex];
+  }
+
+  bool DummyBackend::containsWritableWord(const Bar& bar, uint64_t beginWord, uint64_t endWord) {
+    if(bar.nReadOnlyWords == 0 || endWord > bar.readOnly.size()) {
+      return beginWord < endWord;
+    }
+    for(uint64_t wordIndex = beginWord; wordIndex < endWord; ++wordIndex) {
+      if(!bar.readOnly[wordIndex]) {
+        return true;
+      }
+    }
+    return false;
   }
 
   void DummyBackend::setWriteCallbackFunction(
       AddressRange addressRange, boost::function<void(void)> const& writeCallbackFunction) {
-    _writeCallbackFunctions.insert(
-        std::pair<AddressRange, boost::function<void(void)>>(addressRange, writeCallbackFunction));
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& barInfo = getOrCreateBar(addressRange.bar);
+    uint64_t beginWord = addressRange.offset / sizeof(int32_t);
+    uint64_t endWord = (addressRange.offset + addressRange.sizeInBytes + sizeof(int32_t) - 1) / sizeof(int32_t);
+    WriteCallback callback{beginWord, endWord, writeCallbackFunction};
+
+    // keep the callbacks sorted by their begin, callbacks with the same begin stay in the order of registration
+    auto it = std::upper_bound(barInfo.writeCallbacks.begin(), barInfo.writeCallbacks.end(), beginWord,
+        [](uint64_t word, const WriteCallback& other) { return word < other.beginWord; });
+    auto index = static_cast<size_t>(it - barInfo.writeCallbacks.begin());
+    barInfo.writeCallbacks.insert(it, std::move(callback));
+
+    barInfo.maxEndWord.resize(barInfo.writeCallbacks.size());
+    for(size_t i = index; i < barInfo.writeCallbacks.size(); ++i) {
+      barInfo.maxEndWord[i] = std::max(barInfo.writeCallbacks[i].endWord, i > 0 ? barInfo.maxEndWord[i - 1] : 0);
+    }
   }
 
   void DummyBackend::runWriteCallbackFunctionsForAddressRange(AddressRange addressRange) {
@@ -113,23 +194,30 @@ namespace ChimeraTK {
   }
 
   std::list<boost::function<void(void)>> DummyBackend::findCallbackFunctionsForAddressRange(AddressRange addressRange) {
-    // as callback functions are not sortable, we want to loop the multimap only
-    // once.
     // FIXME: If the same function is registered more than one, it may be executed
     // multiple times
-
-    // we only want the start address of the range, so we set size to 0
-    AddressRange firstAddressInBar(addressRange.bar, 0, 0);
-    AddressRange endAddress(addressRange.bar, addressRange.offset + addressRange.sizeInBytes, 0);
-
-    auto startIterator = _writeCallbackFunctions.lower_bound(firstAddressInBar);
-
-    auto endIterator = _writeCallbackFunctions.lower_bound(endAddress);
-
     std::list<boost::function<void(void)>> returnList;
-    for(auto callbackIter = startIterator; callbackIter != endIterator; ++callbackIter) {
-      if(isWriteRangeOverlap(callbackIter->first, addressRange)) {
-        returnList.push_back(callbackIter->second);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto* barInfo = findBar(addressRange.bar);
+    if(!barInfo || barInfo->writeCallbacks.empty()) {
+      return returnList;
+    }
+    uint64_t beginWord = addressRange.offset / sizeof(int32_t);
+    uint64_t endWord = (addressRange.offset + addressRange.sizeInBytes + sizeof(int32_t) - 1) / sizeof(int32_t);
+
+    // All callbacks starting before the end of the range are candidates. Go backwards through them until no earlier
+    // callback reaches into the range any more.
+    auto candidatesEnd = std::lower_bound(barInfo->writeCallbacks.begin(), barInfo->writeCallbacks.end(), endWord,
+        [](const WriteCallback& callback, uint64_t word) { return callback.beginWord < word; });
+    for(auto i = static_cast<size_t>(candidatesEnd - barInfo->writeCallbacks.begin()); i > 0; --i) {
+      if(barInfo->maxEndWord[i - 1] <= beginWord) {
+        break;
+      }
+      const auto& callback = barInfo->writeCallbacks[i - 1];
+      if(callback.endWord > beginWord && containsWritableWord(*barInfo, std::max(beginWord, callback.beginWord),
+                                              std::min(endWord, callback.endWord))) {
+        returnList.push_front(callback.function);
       }
     }
 
@@ -144,17 +232,18 @@ namespace ChimeraTK {
     uint64_t startAddress = std::max(firstRange.offset, secondRange.offset);
     uint64_t endAddress =
         std::min(firstRange.offset + firstRange.sizeInBytes, secondRange.offset + secondRange.sizeInBytes);
+    if(startAddress >= endAddress) {
+      return false;
+    }
 
     // if at least one register is writable there is an overlap of writable
     // registers
-    for(uint64_t address = startAddress; address < endAddress; address += sizeof(int32_t)) {
-      if(!isReadOnly(firstRange.bar, address)) {
-        return true;
-      }
+    const auto* barInfo = findBar(firstRange.bar);
+    if(!barInfo) {
+      return true;
     }
-
-    // we looped all possible registers, none is writable
-    return false;
+    return containsWritableWord(*barInfo, startAddress / sizeof(int32_t),
+        (endAddress + sizeof(int32_t) - 1) / sizeof(int32_t));
   }
 
   boost::shared_ptr<DeviceBackend> DummyBackend::createInstance(
@@ -169,8 +258,11 @@ namespace ChimeraTK {
     // dmap file is relative to the dmap file location. Converting the relative
     // mapFile path to an absolute path avoids issues when the dmap file is not
     // in the working directory of the application.
-    return returnInstance<DummyBackend>(
+    auto backend = returnInstance<DummyBackend>(
         address, convertPathRelativeToDmapToAbs(parameters["map"]), parameters["DataConsistencyKeys"]);
+    boost::static_pointer_cast<DummyBackend>(backend)->setMergePolicy(parameters);
+    boost::static_pointer_cast<DummyBackend>(backend)->setAsyncDistributionPolicy(parameters);
+    return backend;
   }
 
   std::string DummyBackend::convertPathRelativeToDmapToAbs(const std::string& mapfileName) {
@@ -199,4 +291,11 @@ namespace ChimeraTK {
     return VersionNumber{nullptr};
   }
 
+  void DummyBackend::reportMissedInterrupts(uint32_t interruptNumber, uint64_t nMissed) {
+    auto asyncDomain = _asyncDomainsContainer.getDomain(interruptNumber);
+    if(asyncDomain) {
+      asyncDomain->reportMissedInterrupts(nMissed);
+    }
+  }
+
 } // namespace ChimeraTK
@@ -71,8 +71,12 @@ namespace ChimeraTK {
                 "LNMBackendBitAccessors only work with target registers of size 1: " + registerPathName);
           }
           map[key].accessor = _accessor;
+          // A snapshot left from an expired target accessor must not be used with the buffer of the new one
+          std::lock_guard<std::recursive_mutex> snapshotLock(map[key].mutex);
+          map[key].snapshot.valid = false;
         }
-        lock = std::unique_lock<std::recursive_mutex>(map[key].mutex, std::defer_lock);
+        _shared = &map[key];
+        lock = std::unique_lock<std::recursive_mutex>(_shared->mutex, std::defer_lock);
       }
       // allocate and initialise the buffer
       NDRegisterAccessor<UserType>::buffer_2D.resize(1);
@@ -84,6 +88,9 @@ namespace ChimeraTK {
 
     void doReadTransferSynchronously() override {
       assert(lock.owns_lock());
+      if(_useSnapshot) {
+        return;
+      }
       _accessor->readTransfer();
     }
 
@@ -94,12 +101,37 @@ namespace ChimeraTK {
 
     void doPreRead(TransferType type) override {
       lock.lock();
+      _transferStartTime = std::chrono::steady_clock::now();
+
+      // Reuse the last read of the target accessor, if it is recent enough and has not yet been used by this accessor.
+      // Inside a TransferGroup, the target is read by the group anyway.
+      auto& snapshot = _shared->snapshot;
+      _useSnapshot = _dev->_maxBitReadAge.count() > 0 && !TransferElement::_isInTransferGroup && snapshot.valid &&
+          snapshot.id != _lastSnapshotId && _transferStartTime - snapshot.time <= _dev->_maxBitReadAge &&
+          _dev->isFunctional() && snapshot.versionOnOpen == _dev->getVersionOnOpen();
+      if(_useSnapshot) {
+        return;
+      }
+
+      snapshot.valid = false;
       _accessor->preRead(type);
     }
 
     void doPostRead(TransferType type, bool hasNewData) override {
       auto unlock = cppext::finally([this] { this->lock.unlock(); });
-      _accessor->postRead(type, hasNewData);
+      auto& snapshot = _shared->snapshot;
+      if(_useSnapshot) {
+        _lastSnapshotId = snapshot.id;
+      }
+      else {
+        _accessor->postRead(type, hasNewData);
+        if(hasNewData) {
+          snapshot.valid = true;
+          snapshot.time = _transferStartTime;
+          snapshot.versionOnOpen = _dev->getVersionOnOpen();
+          _lastSnapshotId = ++snapshot.id;
+        }
+      }
       if(!hasNewData) return;
       if(_accessor->accessData(0) & _bitMask) {
         NDRegisterAccessor<UserType>::buffer_2D[0][0] = numericToUserType<UserType>(true);
@@ -113,6 +145,7 @@ namespace ChimeraTK {
 
     void doPreWrite(TransferType type, VersionNumber) override {
       lock.lock();
+      _shared->snapshot.valid = false;
 
       if(!userTypeToNumeric<ChimeraTK::Boolean>(NDRegisterAccessor<UserType>::buffer_2D[0][0])) {
         _accessor->accessData(0) &= ~(_bitMask);
@@ -171,6 +204,19 @@ namespace ChimeraTK {
     /// Since we have a shared pointer to that backend, the mutex is always valid.
     std::unique_lock<std::recursive_mutex> lock;
 
+    /// Entry of the shared target accessor in the sharedAccessorMap of the LogicalNameMappingBackend. Entries are never
+    /// removed from the map, so the pointer stays valid as long as the backend exists.
+    LogicalNameMappingBackend::SharedAccessor<uint64_t>* _shared;
+
+    /// Whether the current read uses the snapshot of the target accessor instead of reading it
+    bool _useSnapshot{false};
+
+    /// Id of the snapshot of the target accessor last used by this accessor
+    uint64_t _lastSnapshotId{0};
+
+    /// Start time of the current read transfer
+    std::chrono::steady_clock::time_point _transferStartTime;
+
     /// register and module name
     RegisterPath _registerPathName;
 
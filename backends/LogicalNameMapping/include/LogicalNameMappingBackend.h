@@ -7,6 +7,7 @@
 #include "LNMBackendRegisterInfo.h"
 #include "LNMVariable.h"
 
+#include <chrono>
 #include <mutex>
 #include <unordered_set>
 #include <utility>
@@ -73,6 +74,19 @@ namespace ChimeraTK {
     struct SharedAccessor {
       boost::weak_ptr<NDRegisterAccessor<UserType>> accessor;
       std::recursive_mutex mutex;
+
+      /** Snapshot of the last read of the shared accessor, which can be reused by LNMBackendBitAccessor instead of
+       *  reading again, see _maxBitReadAge. Only access while holding the mutex. */
+      struct Snapshot {
+        /// Incremented on each read, so each bit accessor can reuse a snapshot at most once
+        uint64_t id{0};
+        /// Cleared when the shared accessor is written, since the data in its buffer might not be in the device then
+        bool valid{false};
+        /// Time when the read transfer has started
+        std::chrono::steady_clock::time_point time;
+        /// getVersionOnOpen() of the backend at the time of the read, so snapshots do not survive a re-open
+        VersionNumber versionOnOpen{nullptr};
+      } snapshot;
     };
 
     /** Map of target accessors which are potentially shared across our accessors. An example is the target accessors of
@@ -85,6 +99,13 @@ namespace ChimeraTK {
     /// a mutex to be locked when sharedAccessorMap (the container) is changed
     std::mutex sharedAccessorMap_mutex;
 
+    /** Maximum age of the snapshot of a shared target accessor, for which a LNMBackendBitAccessor uses the snapshot
+     *  instead of reading the target register again. Each bit accessor uses a snapshot at most once, so reading all
+     *  bits of a register one after another results in a single read of the target register, while reading the same
+     *  bit twice always reads the target again. Set through the CDD parameter "maxBitReadAge" (in milliseconds). Zero
+     *  (the default) disables reusing snapshots. */
+    std::chrono::steady_clock::duration _maxBitReadAge{0};
+
     /** Map of variables and constants. This map contains the mpl tables with the actual values and a mutex for each of
      * them. It has to be mutable as the parse function must be const.
      */
@@ -115,6 +115,7 @@ namespace ChimeraTK::LNMBackend {
       auto it = map.find(key);
       if(it != map.end()) {
         _lock = ReferenceCountedUniqueLock(it->second.mutex);
+        _snapshot = &it->second.snapshot;
       }
       else {
         assert(false);
@@ -178,6 +179,8 @@ namespace ChimeraTK::LNMBackend {
 
     void doPreWrite(TransferType type, VersionNumber versionNumber) override {
       _lock.lock();
+      // the shared target buffer is modified, so LNMBackendBitAccessors must not use it as snapshot any more
+      _snapshot->valid = false;
 
       if(!_writeable) {
         throw ChimeraTK::logic_error(
@@ -257,6 +260,7 @@ namespace ChimeraTK::LNMBackend {
     uint64_t _baseBitMask;
 
     ReferenceCountedUniqueLock _lock;
+    LogicalNameMappingBackend::SharedAccessor<uint64_t>::Snapshot* _snapshot{nullptr};
     VersionNumber _temporaryVersion;
     bool _writeable{false};
     std::unique_ptr<RawConverter::ConverterLoopHelper> _converterLoopHelper;
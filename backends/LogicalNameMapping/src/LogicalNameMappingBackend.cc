@@ -120,6 +120,16 @@ namespace ChimeraTK {
     }
     auto ptr = boost::make_shared<LogicalNameMappingBackend>(parameters["map"]);
     parameters.erase(parameters.find("map"));
+    auto it = parameters.find("maxBitReadAge");
+    if(it != parameters.end()) {
+      try {
+        ptr->_maxBitReadAge = std::chrono::milliseconds(std::stoul(it->second));
+      }
+      catch(std::exception&) {
+        throw ChimeraTK::logic_error(
+            "LogicalNameMappingBackend: Invalid value for parameter 'maxBitReadAge': '" + it->second + "'");
+      }
+    }
     ptr->_parameters = parameters;
     return boost::static_pointer_cast<DeviceBackend>(ptr);
   }
@@ -223,7 +233,7 @@ namespace ChimeraTK {
 
   RegisterCatalogue LogicalNameMappingBackend::getRegisterCatalogue() const {
     if(catalogueCompleted) {
-      return RegisterCatalogue(_catalogue_mutable.clone());
+      return RegisterCatalogue(_catalogue_mutable.getSnapshot());
     }
     parse();
 
@@ -299,7 +309,7 @@ namespace ChimeraTK {
     }
 
     catalogueCompleted = true;
-    return RegisterCatalogue(_catalogue_mutable.clone());
+    return RegisterCatalogue(_catalogue_mutable.getSnapshot());
   }
 
   /********************************************************************************************************************/
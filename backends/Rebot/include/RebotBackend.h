@@ -16,10 +16,12 @@
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace ChimeraTK {
@@ -55,9 +57,27 @@ namespace ChimeraTK {
     boost::chrono::steady_clock::time_point _lastSendTime;
     unsigned int _connectionTimeout;
 
+    /// Maximum number of requests sent to the server before waiting for the responses
+    size_t _requestWindow;
+
+    /// A transfer announced through announceRead() or announceWrite()
+    struct AnnouncedTransfer {
+      const void* owner;
+      uint32_t addressInBytes;
+      size_t sizeInBytes;
+      int32_t* readTarget;
+      int32_t const* writeSource;
+      bool done{false};
+    };
+
+    /// Announced transfers of each thread. Only access when holding the mutex.
+    std::map<std::thread::id, std::vector<AnnouncedTransfer>> _announcedTransfers;
+
    public:
+    /** If requestWindow is bigger than 1, up to requestWindow requests are sent back to back before waiting for the
+     *  responses. This also applies to the transfers of a TransferGroup, which are all executed together. */
     RebotBackend(std::string boardAddr, std::string port, const std::string& mapFileName = "",
-        uint32_t connectionTimeout_sec = DEFAULT_CONNECTION_TIMEOUT_sec);
+        uint32_t connectionTimeout_sec = DEFAULT_CONNECTION_TIMEOUT_sec, size_t requestWindow = 1);
     ~RebotBackend() override;
     /// The function opens the connection to the device
     void open() override;
@@ -71,8 +91,19 @@ namespace ChimeraTK {
 
     size_t minimumTransferAlignment([[maybe_unused]] uint64_t bar) const override { return 4; }
 
+    void announceRead(const void* owner, uint64_t bar, uint64_t address, int32_t* data, size_t sizeInBytes) override;
+    void announceWrite(
+        const void* owner, uint64_t bar, uint64_t address, int32_t const* data, size_t sizeInBytes) override;
+    void withdrawTransfers(const void* owner) override;
+
    protected:
     void heartbeatLoop(const boost::shared_ptr<ThreadInformerMutex>& threadInformerMutex);
+
+    /** If the given transfer has been announced by the calling thread, execute all pending announced transfers of the
+     *  calling thread in the same direction together and return true. Return false if the transfer has not been
+     *  announced. Must be called while holding the mutex. */
+    bool executeAnnouncedTransfers(bool isWrite, uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes);
+
     boost::thread _heartbeatThread;
 
     const static uint32_t DEFAULT_CONNECTION_TIMEOUT_sec{5};
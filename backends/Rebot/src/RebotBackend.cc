@@ -10,22 +10,25 @@
 
 #include <boost/bind/bind.hpp>
 
+#include <algorithm>
 #include <sstream>
 #include <utility>
 
 namespace ChimeraTK {
 
-  std::unique_ptr<RebotProtocolImplementor> getProtocolImplementor(boost::shared_ptr<Rebot::Connection>& c);
+  std::unique_ptr<RebotProtocolImplementor> getProtocolImplementor(
+      boost::shared_ptr<Rebot::Connection>& c, size_t requestWindow);
   uint32_t getProtocolVersion(boost::shared_ptr<Rebot::Connection>& c);
   uint32_t parseRxServerHello(const std::vector<uint32_t>& serverHello);
 
-  std::unique_ptr<RebotProtocolImplementor> getProtocolImplementor(boost::shared_ptr<Rebot::Connection>& c) {
+  std::unique_ptr<RebotProtocolImplementor> getProtocolImplementor(
+      boost::shared_ptr<Rebot::Connection>& c, size_t requestWindow) {
     auto serverVersion = getProtocolVersion(c);
     if(serverVersion == 0) {
-      return std::make_unique<RebotProtocol0>(c);
+      return std::make_unique<RebotProtocol0>(c, requestWindow);
     }
     if(serverVersion == 1) {
-      return std::make_unique<RebotProtocol1>(c);
+      return std::make_unique<RebotProtocol1>(c, requestWindow);
     }
     c->close();
     std::stringstream errorMessage;
@@ -65,12 +68,13 @@ namespace ChimeraTK {
     return serverHello.at(2);
   }
 
-  RebotBackend::RebotBackend(
-      std::string boardAddr, std::string port, const std::string& mapFileName, uint32_t connectionTimeout_sec)
+  RebotBackend::RebotBackend(std::string boardAddr, std::string port, const std::string& mapFileName,
+      uint32_t connectionTimeout_sec, size_t requestWindow)
   : NumericAddressedBackend(mapFileName), _boardAddr(std::move(boardAddr)), _port(std::move(port)),
     _threadInformerMutex(boost::make_shared<ThreadInformerMutex>()),
     _connection(boost::make_shared<Rebot::Connection>(_boardAddr, _port, connectionTimeout_sec)),
     _lastSendTime(testable_rebot_sleep::now()), _connectionTimeout(Rebot::DEFAULT_CONNECTION_TIMEOUT),
+    _requestWindow(std::max(requestWindow, size_t(1))),
     _heartbeatThread([&]() { heartbeatLoop(_threadInformerMutex); }) {}
 
   RebotBackend::~RebotBackend() {
@@ -97,7 +101,7 @@ namespace ChimeraTK {
     _connection->open();
 
     _lastSendTime = testable_rebot_sleep::now();
-    _protocolImplementor = getProtocolImplementor(_connection);
+    _protocolImplementor = getProtocolImplementor(_connection, _requestWindow);
 
     setOpenedAndClearException();
   }
@@ -111,6 +115,9 @@ namespace ChimeraTK {
     checkActiveException();
 
     _lastSendTime = testable_rebot_sleep::now();
+    if(executeAnnouncedTransfers(false, addressInBytes, data, sizeInBytes)) {
+      return;
+    }
     _protocolImplementor->read(addressInBytes, data, sizeInBytes);
   }
 
@@ -123,15 +130,103 @@ namespace ChimeraTK {
     checkActiveException();
 
     _lastSendTime = testable_rebot_sleep::now();
+    if(executeAnnouncedTransfers(true, addressInBytes, data, sizeInBytes)) {
+      return;
+    }
     _protocolImplementor->write(addressInBytes, data, sizeInBytes);
   }
 
+  /********************************************************************************************************************/
+
+  void RebotBackend::announceRead(
+      const void* owner, uint64_t /*bar*/, uint64_t address, int32_t* data, size_t sizeInBytes) {
+    if(_requestWindow < 2) {
+      // no pipelining: just execute the transfers one by one
+      return;
+    }
+    std::lock_guard<std::mutex> lock(_threadInformerMutex->mutex);
+    _announcedTransfers[std::this_thread::get_id()].push_back(
+        {owner, static_cast<uint32_t>(address), sizeInBytes, data, nullptr});
+  }
+
+  /********************************************************************************************************************/
+
+  void RebotBackend::announceWrite(
+      const void* owner, uint64_t /*bar*/, uint64_t address, int32_t const* data, size_t sizeInBytes) {
+    if(_requestWindow < 2) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(_threadInformerMutex->mutex);
+    _announcedTransfers[std::this_thread::get_id()].push_back(
+        {owner, static_cast<uint32_t>(address), sizeInBytes, nullptr, data});
+  }
+
+  /********************************************************************************************************************/
+
+  void RebotBackend::withdrawTransfers(const void* owner) {
+    if(_requestWindow < 2) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(_threadInformerMutex->mutex);
+    auto it = _announcedTransfers.find(std::this_thread::get_id());
+    if(it == _announcedTransfers.end()) {
+      return;
+    }
+    std::erase_if(it->second, [&](const AnnouncedTransfer& t) { return t.owner == owner; });
+    if(it->second.empty()) {
+      _announcedTransfers.erase(it);
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  bool RebotBackend::executeAnnouncedTransfers(
+      bool isWrite, uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes) {
+    auto it = _announcedTransfers.find(std::this_thread::get_id());
+    if(it == _announcedTransfers.end()) {
+      return false;
+    }
+    auto& transfers = it->second;
+
+    auto isSameDirection = [&](const AnnouncedTransfer& t) { return (t.writeSource != nullptr) == isWrite; };
+    auto match = std::find_if(transfers.begin(), transfers.end(), [&](const AnnouncedTransfer& t) {
+      auto* tData = isWrite ? t.writeSource : t.readTarget;
+      return isSameDirection(t) && t.addressInBytes == addressInBytes && t.sizeInBytes == sizeInBytes && tData == data;
+    });
+    if(match == transfers.end()) {
+      return false;
+    }
+    if(match->done) {
+      // already executed together with a previously executed transfer
+      return true;
+    }
+
+    // Execute all pending transfers in the same direction in one go, in the order of announcement
+    std::vector<RebotProtocolImplementor::Request> requests;
+    for(auto& t : transfers) {
+      if(!t.done && isSameDirection(t)) {
+        requests.push_back({t.addressInBytes, t.sizeInBytes, t.readTarget, t.writeSource});
+        t.done = true;
+      }
+    }
+    try {
+      _protocolImplementor->transfer(requests);
+    }
+    catch(...) {
+      // Do not report the other transfers as done. They will be executed (and most likely fail) one by one.
+      std::erase_if(transfers, [&](const AnnouncedTransfer& t) { return t.done && isSameDirection(t); });
+      throw;
+    }
+    return true;
+  }
+
   void RebotBackend::closeImpl() {
     std::lock_guard<std::mutex> lock(_threadInformerMutex->mutex);
 
     _opened = false;
     _connection->close();
     _protocolImplementor.reset(nullptr);
+    _announcedTransfers.clear();
   }
 
   // FIXME #11279 Implement API breaking changes from linter warnings
@@ -155,7 +250,25 @@ namespace ChimeraTK {
     if(it != parameters.end()) {
       timeout = static_cast<uint32_t>(std::stoul(it->second));
     }
-    return boost::shared_ptr<RebotBackend>(new RebotBackend(tmcbIP, portNumber, mapFileName, timeout));
+
+    size_t requestWindow = 1;
+    it = parameters.find("requestWindow");
+    if(it != parameters.end()) {
+      try {
+        requestWindow = std::stoul(it->second);
+      }
+      catch(std::exception&) {
+        throw ChimeraTK::logic_error("RebotBackend: Invalid value for parameter 'requestWindow': '" + it->second + "'");
+      }
+      if(requestWindow == 0) {
+        throw ChimeraTK::logic_error("RebotBackend: Parameter 'requestWindow' must be at least 1");
+      }
+    }
+
+    auto backend = boost::shared_ptr<RebotBackend>(
+        new RebotBackend(tmcbIP, portNumber, mapFileName, timeout, requestWindow));
+    backend->setMergePolicy(parameters);
+    return backend;
   }
 
   void RebotBackend::heartbeatLoop(const boost::shared_ptr<ThreadInformerMutex>& threadInformerMutex) {
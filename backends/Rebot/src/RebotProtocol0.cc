@@ -7,12 +7,14 @@
 #include "Exception.h"
 #include "RebotProtocolDefinitions.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace ChimeraTK {
   using namespace Rebot;
 
-  RebotProtocol0::RebotProtocol0(boost::shared_ptr<Connection>& tcpCommunicator) : _tcpCommunicator(tcpCommunicator) {}
+  RebotProtocol0::RebotProtocol0(boost::shared_ptr<Connection>& tcpCommunicator, size_t requestWindow)
+  : _tcpCommunicator(tcpCommunicator), _requestWindow(std::max(requestWindow, size_t(1))) {}
 
   RebotProtocol0::RegisterInfo::RegisterInfo(uint32_t addressInBytes, uint32_t sizeInBytes) {
     if(sizeInBytes % 4 != 0) {
@@ -27,69 +29,134 @@ namespace ChimeraTK {
     nWords = sizeInBytes / 4;
   }
 
+  /********************************************************************************************************************/
+
   void RebotProtocol0::read(uint32_t addressInBytes, int32_t* data, size_t sizeInBytes) {
+    transfer({{addressInBytes, sizeInBytes, data, nullptr}});
+  }
+
+  /********************************************************************************************************************/
+
+  void RebotProtocol0::write(uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes) {
+    transfer({{addressInBytes, sizeInBytes, nullptr, data}});
+  }
+
+  /********************************************************************************************************************/
+
+  void RebotProtocol0::transfer(const std::vector<Request>& requests) {
     // locking is happening in the backend
     // check for isOpen() is happening in the backend which does the bookkeeping
 
-    RegisterInfo registerInfo(addressInBytes, sizeInBytes);
+    // check all requests before sending anything, so invalid requests do not leave the transfer half done
+    std::vector<RegisterInfo> registerInfos;
+    registerInfos.reserve(requests.size());
+    for(const auto& request : requests) {
+      registerInfos.emplace_back(request.addressInBytes, request.sizeInBytes);
+    }
 
-    // read implementation for protocol 0 : we are limited in the read size and
-    // have to do multiple calls to fetchFromRebotServer
+    Pipeline pipeline(*_tcpCommunicator, _requestWindow);
+    for(size_t i = 0; i < requests.size(); ++i) {
+      if(requests[i].isWrite()) {
+        queueWrite(pipeline, registerInfos[i], requests[i].writeSource);
+      }
+      else {
+        queueRead(pipeline, registerInfos[i], requests[i].readTarget);
+      }
+    }
+    pipeline.flush();
+  }
 
-    size_t iterationsRequired = registerInfo.nWords / READ_BLOCK_SIZE;
-    size_t leftOverWords = registerInfo.nWords % READ_BLOCK_SIZE;
+  /********************************************************************************************************************/
 
-    // read in till the last multiple of READ_BLOCK_SIZE
-    for(size_t count = 0; count < iterationsRequired; ++count) {
-      fetchFromRebotServer(
-          registerInfo.addressInWords + (count * READ_BLOCK_SIZE), READ_BLOCK_SIZE, data + (count * READ_BLOCK_SIZE));
+  void RebotProtocol0::queueRead(Pipeline& pipeline, const RegisterInfo& registerInfo, int32_t* data) {
+    // read implementation for protocol 0 : we are limited in the read size and
+    // have to split the request into multiple commands
+    for(uint32_t offset = 0; offset < registerInfo.nWords; offset += READ_BLOCK_SIZE) {
+      auto wordsToRead = std::min(registerInfo.nWords - offset, static_cast<uint32_t>(READ_BLOCK_SIZE));
+      pipeline.addRead(registerInfo.addressInWords + offset, wordsToRead, data + offset);
     }
-    // read remaining from the last multiple of READ_BLOCK_SIZE
-    fetchFromRebotServer(registerInfo.addressInWords + (iterationsRequired * READ_BLOCK_SIZE), leftOverWords,
-        data + (iterationsRequired * READ_BLOCK_SIZE));
   }
 
-  void RebotProtocol0::write(uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes) {
-    RegisterInfo registerInfo(addressInBytes, sizeInBytes);
+  /********************************************************************************************************************/
 
+  void RebotProtocol0::queueWrite(Pipeline& pipeline, const RegisterInfo& registerInfo, int32_t const* data) {
     // Implementation for protocol version 0: Only single word write possible
-    std::vector<uint32_t> packet(3);
-    for(unsigned int i = 0; i < registerInfo.nWords; ++i) {
-      packet[0] = SINGLE_WORD_WRITE;
-      packet[1] = registerInfo.addressInWords++;
-      packet[2] = static_cast<uint32_t>(data[i]);
-      _tcpCommunicator->write(packet);
-      _tcpCommunicator->read(1); // response is ignored for now
+    for(uint32_t i = 0; i < registerInfo.nWords; ++i) {
+      pipeline.addWrite({SINGLE_WORD_WRITE, registerInfo.addressInWords + i, static_cast<uint32_t>(data[i])});
     }
   }
 
-  void RebotProtocol0::fetchFromRebotServer(uint32_t wordAddress, uint32_t numberOfWords, int32_t* dataLocation) const {
-    sendRebotReadRequest(wordAddress, numberOfWords);
+  /********************************************************************************************************************/
 
-    // first check that the response starts with READ_ACK. If it is an error code
-    // there might be just one word in the response.
-    std::vector<uint32_t> responseCode = _tcpCommunicator->read(1);
-    if(responseCode[0] != Rebot::READ_ACK) {
-      // FIXME: can we do somwthing more clever here?
-      throw ChimeraTK::runtime_error("Reading via ReboT failed. Response code: " + std::to_string(responseCode[0]));
+  void RebotProtocol0::Pipeline::addRead(uint32_t wordAddress, uint32_t numberOfWords, int32_t* dataLocation) {
+    // Limit the amount of response data in flight. Otherwise the server might block while sending responses, while we
+    // are still blocked sending commands.
+    if(!_pendingResponses.empty() && _pendingResponseWords + numberOfWords > MAX_PIPELINED_RESPONSE_WORDS) {
+      flush();
     }
+    _sendBuffer.insert(_sendBuffer.end(), {MULTI_WORD_READ, wordAddress, numberOfWords});
+    _pendingResponses.push_back({dataLocation, numberOfWords});
+    _pendingResponseWords += numberOfWords + 1;
+    commandAdded();
+  }
 
-    // now that we know that the command worked on the server side we can read the
-    // rest of the data
-    std::vector<uint32_t> readData = _tcpCommunicator->read(numberOfWords);
-    transferVectorToDataPtr(readData, dataLocation);
+  /********************************************************************************************************************/
+
+  void RebotProtocol0::Pipeline::addWrite(const std::vector<uint32_t>& packet) {
+    _sendBuffer.insert(_sendBuffer.end(), packet.begin(), packet.end());
+    _pendingResponses.push_back({nullptr, 0});
+    _pendingResponseWords += 1;
+    commandAdded();
   }
 
-  void RebotProtocol0::sendRebotReadRequest(const uint32_t wordAddress, const uint32_t wordsToRead) const {
-    unsigned int datasendSize = 3 * sizeof(int);
-    std::vector<char> datasend(datasendSize);
-    std::vector<uint32_t> packet(3);
-    packet[0] = MULTI_WORD_READ;
-    packet[1] = wordAddress;
-    packet[2] = wordsToRead;
-    _tcpCommunicator->write(packet);
+  /********************************************************************************************************************/
+
+  void RebotProtocol0::Pipeline::commandAdded() {
+    if(_pendingResponses.size() >= _requestWindow) {
+      flush();
+    }
   }
 
+  /********************************************************************************************************************/
+
+  void RebotProtocol0::Pipeline::flush() {
+    if(_pendingResponses.empty()) {
+      return;
+    }
+
+    auto pendingResponses = std::move(_pendingResponses);
+    _pendingResponses.clear();
+    _pendingResponseWords = 0;
+
+    _connection.write(_sendBuffer);
+    _sendBuffer.clear();
+
+    for(size_t i = 0; i < pendingResponses.size(); ++i) {
+      const auto& response = pendingResponses[i];
+      std::vector<uint32_t> responseCode = _connection.read(1);
+      if(response.dataLocation == nullptr) {
+        continue; // write response is ignored for now
+      }
+
+      // first check that the response starts with READ_ACK. If it is an error code
+      // there might be just one word in the response.
+      if(responseCode[0] != Rebot::READ_ACK) {
+        if(i + 1 < pendingResponses.size()) {
+          // We cannot tell the responses to the remaining commands apart from data any more.
+          _connection.close();
+        }
+        // FIXME: can we do somwthing more clever here?
+        throw ChimeraTK::runtime_error("Reading via ReboT failed. Response code: " + std::to_string(responseCode[0]));
+      }
+
+      // now that we know that the command worked on the server side we can read the
+      // rest of the data
+      transferVectorToDataPtr(_connection.read(response.numberOfWords), response.dataLocation);
+    }
+  }
+
+  /********************************************************************************************************************/
+
   void RebotProtocol0::transferVectorToDataPtr(const std::vector<uint32_t>& source, int32_t* destination) {
     // FIXME: just use memcopy
     for(const auto& i : source) {
@@ -99,6 +166,8 @@ namespace ChimeraTK {
     }
   }
 
+  /********************************************************************************************************************/
+
   void RebotProtocol0::sendHeartbeat() {
     // just do nothing in v0
   }
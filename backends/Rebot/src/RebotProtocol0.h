@@ -14,11 +14,14 @@ namespace ChimeraTK {
   }
 
   struct RebotProtocol0 : RebotProtocolImplementor {
-    explicit RebotProtocol0(boost::shared_ptr<Rebot::Connection>& tcpCommunicator);
+    /** The requestWindow is the maximum number of requests which are sent to the server before waiting for the
+     *  responses. With the default of 1, each request is a full round trip. */
+    explicit RebotProtocol0(boost::shared_ptr<Rebot::Connection>& tcpCommunicator, size_t requestWindow = 1);
     virtual ~RebotProtocol0() {};
 
     virtual void read(uint32_t addressInBytes, int32_t* data, size_t sizeInBytes) override;
     virtual void write(uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes) override;
+    virtual void transfer(const std::vector<Request>& requests) override;
     virtual void sendHeartbeat() override;
 
     struct RegisterInfo {
@@ -29,10 +32,51 @@ namespace ChimeraTK {
       RegisterInfo(uint32_t addressInBytes, uint32_t sizeInBytes);
     };
 
+    /** Collects commands and sends them back to back in a single write to the connection. The responses are read
+     *  afterwards in the order of the commands. The commands are sent as soon as the request window is full, or when
+     *  flush() is called. */
+    class Pipeline {
+     public:
+      Pipeline(Rebot::Connection& connection, size_t requestWindow)
+      : _connection(connection), _requestWindow(requestWindow) {}
+
+      /// Queue a multi word read. The response data is written to dataLocation.
+      void addRead(uint32_t wordAddress, uint32_t numberOfWords, int32_t* dataLocation);
+
+      /// Queue a write command (complete packet including the command word). The response is a single word.
+      void addWrite(const std::vector<uint32_t>& packet);
+
+      /// Send all queued commands and collect the responses
+      void flush();
+
+     private:
+      struct PendingResponse {
+        int32_t* dataLocation; // nullptr for write responses
+        uint32_t numberOfWords;
+      };
+
+      void commandAdded();
+
+      /// Maximum number of response words to be in flight before the responses are collected
+      static constexpr uint32_t MAX_PIPELINED_RESPONSE_WORDS = 16384;
+
+      Rebot::Connection& _connection;
+      size_t _requestWindow;
+      std::vector<uint32_t> _sendBuffer;
+      std::vector<PendingResponse> _pendingResponses;
+      size_t _pendingResponseWords{0};
+    };
+
     //  protected:
     boost::shared_ptr<Rebot::Connection> _tcpCommunicator;
-    void fetchFromRebotServer(uint32_t wordAddress, uint32_t numberOfWords, int32_t* dataLocation) const;
-    void sendRebotReadRequest(const uint32_t wordAddress, const uint32_t wordsToRead) const;
+    size_t _requestWindow;
+
+    /// Queue the commands for a read request. Protocol 0 is limited to READ_BLOCK_SIZE words per command.
+    virtual void queueRead(Pipeline& pipeline, const RegisterInfo& registerInfo, int32_t* data);
+
+    /// Queue the commands for a write request. Protocol 0 only knows single word writes.
+    virtual void queueWrite(Pipeline& pipeline, const RegisterInfo& registerInfo, int32_t const* data);
+
     static void transferVectorToDataPtr(const std::vector<uint32_t>& source, int32_t* destination);
   };
 
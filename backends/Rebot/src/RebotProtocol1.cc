@@ -9,39 +9,38 @@
 namespace ChimeraTK {
   using namespace Rebot;
 
-  RebotProtocol1::RebotProtocol1(boost::shared_ptr<Connection>& tcpCommunicator)
-  : RebotProtocol0(tcpCommunicator), _lastSendTime(std::chrono::steady_clock::now()) {
+  RebotProtocol1::RebotProtocol1(boost::shared_ptr<Connection>& tcpCommunicator, size_t requestWindow)
+  : RebotProtocol0(tcpCommunicator, requestWindow), _lastSendTime(std::chrono::steady_clock::now()) {
     // Setting the time stamp to now() is sufficient in precision.
     // We know that the server has just replied to the hello before this class was
     // created.
   }
 
-  void RebotProtocol1::read(uint32_t addressInBytes, int32_t* data, size_t sizeInBytes) {
-    // locking is happening in the backend
-    // check for isOpen() is happening in the backend which does the bookkeeping
-
-    RegisterInfo registerInfo(addressInBytes, sizeInBytes);
-    // Resolution of timing is sufficient if we set the timestamp here
-    // We just send one read request at the beginning.
+  void RebotProtocol1::transfer(const std::vector<Request>& requests) {
+    // Resolution of timing is sufficient if we set the timestamp here. Technically
+    // the transfer might send muptilple packets, but it is sufficient to remember
+    // that we triggered it here.
     _lastSendTime = std::chrono::steady_clock::now();
-    fetchFromRebotServer(registerInfo.addressInWords, registerInfo.nWords, data);
+    RebotProtocol0::transfer(requests);
   }
 
-  void RebotProtocol1::write(uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes) {
-    RegisterInfo registerInfo(addressInBytes, sizeInBytes);
+  void RebotProtocol1::queueRead(Pipeline& pipeline, const RegisterInfo& registerInfo, int32_t* data) {
+    if(registerInfo.nWords > 0) {
+      pipeline.addRead(registerInfo.addressInWords, registerInfo.nWords, data);
+    }
+  }
+
+  void RebotProtocol1::queueWrite(Pipeline& pipeline, const RegisterInfo& registerInfo, int32_t const* data) {
     std::vector<uint32_t> writeCommandPacket;
+    writeCommandPacket.reserve(3 + registerInfo.nWords);
     writeCommandPacket.push_back(MULTI_WORD_WRITE);
     writeCommandPacket.push_back(registerInfo.addressInWords);
     writeCommandPacket.push_back(registerInfo.nWords);
     for(unsigned int i = 0; i < registerInfo.nWords; ++i) {
       writeCommandPacket.push_back(data[i]);
     }
-    // Again we timestamp here. Technically the comminucator might send muptilple
-    // packets, but it is sufficient to reemember that we triggered it here.
-    _lastSendTime = std::chrono::steady_clock::now();
-    _tcpCommunicator->write(writeCommandPacket);
-    // FIXME: this returns std::vector<int32_t> of length 1. Do error handling!
-    (void)_tcpCommunicator->read(1);
+    // FIXME: The response is a single word which is ignored. Do error handling!
+    pipeline.addWrite(writeCommandPacket);
   }
 
   void RebotProtocol1::sendHeartbeat() {
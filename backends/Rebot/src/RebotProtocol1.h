@@ -9,11 +9,10 @@
 namespace ChimeraTK {
 
   struct RebotProtocol1 : public RebotProtocol0 {
-    explicit RebotProtocol1(boost::shared_ptr<Rebot::Connection>& tcpCommunicator);
+    explicit RebotProtocol1(boost::shared_ptr<Rebot::Connection>& tcpCommunicator, size_t requestWindow = 1);
     virtual ~RebotProtocol1() {};
 
-    virtual void read(uint32_t addressInBytes, int32_t* data, size_t sizeInBytes) override;
-    virtual void write(uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes) override;
+    virtual void transfer(const std::vector<Request>& requests) override;
     virtual void sendHeartbeat() override;
 
     /** No need to make it atomic (time_points cannot be because they are not
@@ -22,6 +21,12 @@ namespace ChimeraTK {
      * stamp.
      */
     std::chrono::time_point<std::chrono::steady_clock> _lastSendTime;
+
+    /// Protocol 1 is not limited in the read size, so each read request is a single command
+    void queueRead(Pipeline& pipeline, const RegisterInfo& registerInfo, int32_t* data) override;
+
+    /// Protocol 1 supports multi word writes
+    void queueWrite(Pipeline& pipeline, const RegisterInfo& registerInfo, int32_t const* data) override;
   };
 
 } // namespace ChimeraTK
@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace ChimeraTK {
 
@@ -12,8 +13,24 @@ namespace ChimeraTK {
    *  reuse code from previous versions, or replace the implementation.
    */
   struct RebotProtocolImplementor {
+    /** A single read or write request as part of a call to transfer(). For read requests writeSource is nullptr, for
+     *  write requests readTarget is nullptr. */
+    struct Request {
+      uint32_t addressInBytes;
+      size_t sizeInBytes;
+      int32_t* readTarget{nullptr};
+      int32_t const* writeSource{nullptr};
+
+      [[nodiscard]] bool isWrite() const { return writeSource != nullptr; }
+    };
+
     virtual void read(uint32_t addressInBytes, int32_t* data, size_t sizeInBytes) = 0;
     virtual void write(uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes) = 0;
+
+    /** Execute the given requests in the given order. Implementations may send several requests back to back before
+     *  collecting the responses, so the whole list is transferred with as few round trips as possible. */
+    virtual void transfer(const std::vector<Request>& requests) = 0;
+
     virtual void sendHeartbeat() = 0;
     virtual ~RebotProtocolImplementor() {};
   };
@@ -14,6 +14,7 @@
 #include <boost/move/unique_ptr.hpp>
 #include <boost/unordered_set.hpp>
 
+#include <atomic>
 #include <list>
 #include <map>
 #include <thread>
@@ -61,6 +62,16 @@ namespace ChimeraTK {
 
     VersionNumber triggerInterrupt(uint32_t interruptNumber) override;
 
+    /** Sequence lock protecting the contents of one bar, residing in shared memory. The upper 32 bits of the state hold
+     * the sequence number, which is odd while a write is in progress. The lower 32 bits then hold the PID of the
+     * writing process, so the lock of a writer which crashed can be released by others. The state serialises the
+     * writers of all processes. Readers never block writers: they copy the data without taking any lock and retry if
+     * the state has changed in the meantime. */
+    struct BarSeqLock {
+      std::atomic<uint64_t> state{0};
+    };
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "Atomics in shared memory must be lock free");
+
    private:
     /** name of the map file */
     std::string _mapFile;
@@ -72,9 +83,15 @@ namespace ChimeraTK {
     // Bar sizes
     std::map<uint64_t, size_t> _barSizesInBytes;
 
+    // Sequence locks of the bars, see BarSeqLock. Plain pointers into the shared memory as for _barContents.
+    std::map<uint64_t, BarSeqLock*> _barSeqLocks;
+
     // Naming of bars as shared memory elements
     const char* SHARED_MEMORY_BAR_PREFIX = "BAR_";
 
+    // Naming of the sequence locks as shared memory elements (appended to the bar name)
+    static constexpr const char* SHARED_MEMORY_SEQLOCK_SUFFIX = "_SEQLOCK";
+
     class InterruptDispatcherInterface;
 
     // Helper class to manage the shared memory: automatically construct if
@@ -83,6 +100,13 @@ namespace ChimeraTK {
       friend class SharedDummyBackend;
 
      public:
+      /**
+       * Thrown by the constructor if the existing segment has an incompatible layout but is not used by any process.
+       * The SharedDummyBackend then removes the segment and retries. If the segment is still in use, a
+       * ChimeraTK::runtime_error is thrown instead.
+       */
+      struct UnusedIncompatibleSegment {};
+
       SharedMemoryManager(SharedDummyBackend&, std::size_t instanceIdHash, const std::string&);
       ~SharedMemoryManager();
 
@@ -91,6 +115,11 @@ namespace ChimeraTK {
        */
       SharedMemoryVector* findOrConstructVector(const std::string& objName, size_t size);
 
+      /**
+       * Finds or constructs a sequence lock object in the shared memory.
+       */
+      BarSeqLock* findOrConstructSeqLock(const std::string& objName);
+
       /**
        * Get information on the shared memory segment
        * @retval std::pair<size_t, size_t> first: Size of the memory segment,
@@ -108,6 +137,11 @@ namespace ChimeraTK {
       const char* SHARED_MEMORY_PID_SET_NAME = "PidSet";
       const char* SHARED_MEMORY_REQUIRED_VERSION_NAME = "RequiredVersion";
 
+      // Version of the layout of the shared memory segment, stored under SHARED_MEMORY_REQUIRED_VERSION_NAME. Must be
+      // incremented whenever the objects in the segment change incompatibly. Segments created by older versions of
+      // this library contain 0.
+      static constexpr unsigned SHARED_MEMORY_LAYOUT_VERSION = 1;
+
       SharedDummyBackend& sharedDummyBackend;
 
       // the name of the segment
@@ -119,11 +153,8 @@ namespace ChimeraTK {
       // the allocator instance
       const ShmemAllocator sharedMemoryIntAllocator;
 
-      // Pointers to the set of process IDs and the required version
-      // specifier in shared memory
+      // Pointers to the set of process IDs and the layout version in shared memory
       PidSet* pidSet{nullptr};
-      // Version number is not used for now, but included in shared memory
-      // to facilitate compatibility checks later
       unsigned* requiredVersion{nullptr};
 
       size_t getRequiredMemoryWithOverhead();
@@ -155,6 +186,9 @@ namespace ChimeraTK {
     // Helper routines called in init list
     size_t getTotalRegisterSizeInBytes() const;
 
+    // Look up the bar contents and the sequence lock, and check that the given range is inside the bar
+    std::pair<SharedMemoryVector*, BarSeqLock*> getBar(uint64_t bar, uint64_t address, size_t sizeInBytes);
+
     static void checkSizeIsMultipleOfWordSize(size_t sizeInBytes);
 
     static std::string convertPathRelativeToDmapToAbs(std::string const& mapfileName);
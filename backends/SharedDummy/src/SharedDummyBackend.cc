@@ -14,12 +14,53 @@
 #include <boost/lambda/lambda.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <regex>
 #include <sstream>
 
 namespace ChimeraTK {
 
+  namespace {
+    // The state of a BarSeqLock holds the sequence number in the upper and the PID of the writer in the lower 32 bits.
+    constexpr uint64_t sequenceIncrement = uint64_t(1) << 32;
+    constexpr uint64_t ownerPidMask = sequenceIncrement - 1;
+
+    // Minimum time between two checks whether the owner of a write lock still exists. Checking requires a system call,
+    // and writes usually finish much faster than this.
+    constexpr auto ownerCheckInterval = std::chrono::milliseconds(1);
+
+    bool isWriteInProgress(uint64_t state) {
+      return (state >> 32) & 1;
+    }
+
+    // Wait until no write is in progress and return the state (even sequence number, no owner). A write lock is only
+    // released by someone else than its owner if the owning process no longer exists, i.e. it has crashed while
+    // writing. Slow writers are never interrupted. The owner is only checked after the same write has been in progress
+    // for ownerCheckInterval.
+    uint64_t waitForStableState(std::atomic<uint64_t>& state) {
+      auto current = state.load(std::memory_order_acquire);
+      auto waitingSince = std::chrono::steady_clock::now();
+      while(isWriteInProgress(current)) {
+        std::this_thread::yield();
+        auto newState = state.load(std::memory_order_acquire);
+        if(newState != current) {
+          // the write has finished, possibly followed by another one
+          waitingSince = std::chrono::steady_clock::now();
+        }
+        else if(std::chrono::steady_clock::now() - waitingSince >= ownerCheckInterval) {
+          if(!processExists(static_cast<unsigned>(current & ownerPidMask))) {
+            state.compare_exchange_strong(newState, (current & ~ownerPidMask) + sequenceIncrement);
+            newState = state.load(std::memory_order_acquire);
+          }
+          waitingSince = std::chrono::steady_clock::now();
+        }
+        current = newState;
+      }
+      return current;
+    }
+  } // namespace
+
   SharedDummyBackend::SharedDummyBackend(
       size_t instanceIdHash, const std::string& mapFileName, const std::string& dataConsistencyKeyDescriptor)
   : DummyBackendBase(mapFileName, dataConsistencyKeyDescriptor), _mapFile(mapFileName),
@@ -36,6 +77,12 @@ namespace ChimeraTK {
       boost::interprocess::named_mutex::remove(name.c_str());
       goto retry;
     }
+    catch(SharedMemoryManager::UnusedIncompatibleSegment&) {
+      // left behind by crashed processes using an incompatible version of this library, nobody else is using it
+      std::string name = Utilities::createShmName(instanceIdHash, mapFileName, getUserName());
+      boost::interprocess::shared_memory_object::remove(name.c_str());
+      goto retry;
+    }
 
     setupBarContents();
   }
@@ -56,6 +103,8 @@ namespace ChimeraTK {
       try {
         std::lock_guard<boost::interprocess::named_mutex> lock(sharedMemoryManager->interprocessMutex);
         _barContents[_barSizesInByte.first] = sharedMemoryManager->findOrConstructVector(barName, barSizeInWords);
+        _barSeqLocks[_barSizesInByte.first] =
+            sharedMemoryManager->findOrConstructSeqLock(barName + SHARED_MEMORY_SEQLOCK_SUFFIX);
       }
       catch(boost::interprocess::bad_alloc&) {
         // Clean up
@@ -83,11 +132,18 @@ namespace ChimeraTK {
     }
     checkActiveException();
     checkSizeIsMultipleOfWordSize(sizeInBytes);
-    uint64_t wordBaseIndex = address / sizeof(int32_t);
-
-    std::lock_guard<boost::interprocess::named_mutex> lock(sharedMemoryManager->interprocessMutex);
-    for(uint64_t wordIndex = 0; wordIndex < sizeInBytes / sizeof(int32_t); ++wordIndex) {
-      TRY_REGISTER_ACCESS(data[wordIndex] = _barContents[bar]->at(wordBaseIndex + wordIndex););
+    auto [barContents, seqLock] = getBar(bar, address, sizeInBytes);
+    const int32_t* source = barContents->data() + address / sizeof(int32_t);
+
+    // Copy the data and retry if a write has happened in the meantime. The data is copied with memcpy as in common
+    // seqlock implementations, the fences make sure the copy is done between the two reads of the sequence number.
+    while(true) {
+      auto stable = waitForStableState(seqLock->state);
+      std::memcpy(data, source, sizeInBytes);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if(seqLock->state.load(std::memory_order_relaxed) == stable) {
+        break;
+      }
     }
   }
 
@@ -97,13 +153,33 @@ namespace ChimeraTK {
     }
     checkActiveException();
     checkSizeIsMultipleOfWordSize(sizeInBytes);
-    uint64_t wordBaseIndex = address / sizeof(int32_t);
+    auto [barContents, seqLock] = getBar(bar, address, sizeInBytes);
+    int32_t* target = barContents->data() + address / sizeof(int32_t);
 
-    std::lock_guard<boost::interprocess::named_mutex> lock(sharedMemoryManager->interprocessMutex);
+    // acquire the write lock by making the sequence number odd and recording our PID as owner
+    auto stable = waitForStableState(seqLock->state);
+    while(!seqLock->state.compare_exchange_weak(
+        stable, stable + sequenceIncrement + getOwnPID(), std::memory_order_acquire)) {
+      stable = waitForStableState(seqLock->state);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(target, data, sizeInBytes);
+
+    // release the write lock
+    seqLock->state.store(stable + 2 * sequenceIncrement, std::memory_order_release);
+  }
 
-    for(uint64_t wordIndex = 0; wordIndex < sizeInBytes / sizeof(int32_t); ++wordIndex) {
-      TRY_REGISTER_ACCESS(_barContents[bar]->at(wordBaseIndex + wordIndex) = data[wordIndex];);
+  std::pair<SharedMemoryVector*, SharedDummyBackend::BarSeqLock*> SharedDummyBackend::getBar(
+      uint64_t bar, uint64_t address, size_t sizeInBytes) {
+    auto barIt = _barContents.find(bar);
+    auto endIndex = address / sizeof(int32_t) + sizeInBytes / sizeof(int32_t);
+    if(barIt == _barContents.end() || endIndex > barIt->second->size()) {
+      std::stringstream errorMessage;
+      errorMessage << "Invalid address offset " << address << " in bar " << bar << ".";
+      throw ChimeraTK::logic_error(errorMessage.str());
     }
+    return {barIt->second, _barSeqLocks.at(bar)};
   }
 
   std::string SharedDummyBackend::readDeviceInfo() {
@@ -144,8 +220,10 @@ namespace ChimeraTK {
     // dmap file is relative to the dmap file location. Converting the relative
     // mapFile path to an absolute path avoids issues when the dmap file is not
     // in the working directory of the application.
-    return returnInstance<SharedDummyBackend>(
+    auto backend = returnInstance<SharedDummyBackend>(
         address, instanceIdHash, convertPathRelativeToDmapToAbs(mapFileName), parameters["DataConsistencyKeys"]);
+    boost::static_pointer_cast<SharedDummyBackend>(backend)->setMergePolicy(parameters);
+    return backend;
   }
 
   std::string SharedDummyBackend::convertPathRelativeToDmapToAbs(const std::string& mapfileName) {
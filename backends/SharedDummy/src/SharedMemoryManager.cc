@@ -5,6 +5,8 @@
 #include "SharedDummyBackend.h"
 #include "Utilities.h"
 
+#include <boost/algorithm/string/predicate.hpp>
+
 namespace ChimeraTK {
 
   namespace {
@@ -72,15 +74,26 @@ namespace ChimeraTK {
       // Clean up pidSet, if needed
       bool reInitRequired = checkPidSetConsistency();
 
+      // Check the layout version before touching anything else in an existing segment
+      requiredVersion =
+          segment.find_or_construct<unsigned>(SHARED_MEMORY_REQUIRED_VERSION_NAME)(SHARED_MEMORY_LAYOUT_VERSION);
+      if(*requiredVersion != SHARED_MEMORY_LAYOUT_VERSION) {
+        if(pidSet->empty()) {
+          throw UnusedIncompatibleSegment();
+        }
+        throw ChimeraTK::runtime_error("SharedDummyBackend: shared memory segment " + name + " has layout version " +
+            std::to_string(*requiredVersion) + " but version " + std::to_string(SHARED_MEMORY_LAYOUT_VERSION) +
+            " is required. It is in use by processes linked against an incompatible version of DeviceAccess.");
+      }
+
       // If only "zombie" processes were found in PidSet,
       // reset data entries in shared memory.
       if(reInitRequired) {
         reInitMemory();
+        requiredVersion =
+            segment.find_or_construct<unsigned>(SHARED_MEMORY_REQUIRED_VERSION_NAME)(SHARED_MEMORY_LAYOUT_VERSION);
       }
 
-      // Get memory item for version number
-      requiredVersion = segment.find_or_construct<unsigned>(SHARED_MEMORY_REQUIRED_VERSION_NAME)(0);
-
       // Protect against too many accessing processes to prevent
       // overflow of pidSet in shared memory.
       if(pidSet->size() >= SHARED_MEMORY_N_MAX_MEMBER) {
@@ -143,10 +156,16 @@ namespace ChimeraTK {
     return vector;
   }
 
+  SharedDummyBackend::BarSeqLock* SharedDummyBackend::SharedMemoryManager::findOrConstructSeqLock(
+      const std::string& objName) {
+    return segment.find_or_construct<BarSeqLock>(objName.c_str())();
+  }
+
   size_t SharedDummyBackend::SharedMemoryManager::getRequiredMemoryWithOverhead() {
     // Note: This uses _barSizeInBytes to determine number of vectors used,
     //       as it is initialized when this method gets called in the init list.
-    return SHARED_MEMORY_OVERHEAD_PER_VECTOR * sharedDummyBackend._barSizesInBytes.size() +
+    // Each bar has a vector and a sequence lock object.
+    return (2 * SHARED_MEMORY_OVERHEAD_PER_VECTOR + sizeof(BarSeqLock)) * sharedDummyBackend._barSizesInBytes.size() +
         SHARED_MEMORY_CONST_OVERHEAD + sharedDummyBackend.getTotalRegisterSizeInBytes() + sizeof(ShmForSems);
   }
 
@@ -177,6 +196,9 @@ namespace ChimeraTK {
       if(item == SHARED_MEMORY_REQUIRED_VERSION_NAME) {
         segment.destroy<unsigned>(item.c_str());
       }
+      else if(boost::algorithm::ends_with(item, SHARED_MEMORY_SEQLOCK_SUFFIX)) {
+        segment.destroy<BarSeqLock>(item.c_str());
+      }
       // reset the BAR vectors in shm.
       // Note, InterruptDispatcherInterface uses unique_instance mechanism so it is not affected here
       else if(item != SHARED_MEMORY_PID_SET_NAME) {
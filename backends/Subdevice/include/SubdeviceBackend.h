@@ -5,6 +5,8 @@
 #include "DeviceBackendImpl.h"
 #include "NumericAddressedRegisterCatalogue.h"
 
+#include <chrono>
+#include <functional>
 #include <mutex>
 #include <string>
 
@@ -36,6 +38,21 @@ namespace ChimeraTK {
    * microseconds. Another optional parameter "dataDelay" can be used to configure an additional delay in microseconds
    * between the write of the address and the data registers (defaults to 0 usecs).
    *
+   * The polling of the status register can be tuned with the following optional parameters (for all types with a
+   * status resp. busy register):
+   *  - "spin": number of polls done immediately after starting a transaction, without sleeping in between (defaults
+   *    to 0). Useful if transactions typically complete within a few microseconds.
+   *  - "minSleep": initial polling interval in microseconds. The interval is doubled after each unsuccessful poll
+   *    until it reaches the value of the "sleep" parameter. Defaults to the value of "sleep", i.e. a fixed interval.
+   *  - "busyPush": name of a push-type register (supporting AccessMode::wait_for_new_data) in the target device, which
+   *    receives the value of the status register whenever it changes, e.g. through an interrupt. The status register
+   *    is then no longer read, instead the backend waits for an update with the value 0 after each transaction. The
+   *    spin/sleep settings apply to checking for updates, which does not involve any bus transfers. Requires
+   *    asynchronous reads to be activated.
+   *  - "timeout": time in milliseconds after which waiting for the status register is given up with a runtime_error
+   *    (defaults to 10000).
+   * Statistics about the waiting times can be obtained through getBusyWaitStatistics().
+   *
    *  - "2regs" type: same as "3regs" but without a status register. Instead the
    * sleep parameter is mandatory and specifies the fixed sleep time before each
    * operation.
@@ -54,6 +71,11 @@ namespace ChimeraTK {
    * URI scheme:\n
    * \verbatim(subdevice?type=regWindow&device=<targetDevice>&address=<addressRegister>&writeData=<writeDataRegister>&busy=<busyRegister>&readRequest=<readRequestRegister>&readData=<readDataRegister>&chipSelectRegister=<chipSelectRegister>&chipIndex=<chipIndex>&map=<mapFile>)\endverbatim
    * The "chipIndex" parameter is optional and defaults to 0.
+   * The optional parameter "burst" enables the burst mode for firmware with auto-incrementing addresses: the address
+   * is written only once for up to "burst" consecutive transfers of the data registers. For writes, the data of the
+   * entire burst is written back to back, and the busy flag is awaited once after the last write. For reads, the read
+   * request is written once and the busy flag is awaited once, then readData is read once per transfer, returning the
+   * data of consecutive addresses. Defaults to 0 (burst mode disabled).
    * For compatibility with the 3reg-mode, 'data' can be used instead of 'readData', and 'status' instead of 'busy'
    *
    *  Example: We like to use the register "APP.0.EXT_PZ16M" of the device with
@@ -88,6 +110,17 @@ namespace ChimeraTK {
 
     std::set<DeviceBackend::BackendID> getInvolvedBackendIDs() override;
 
+    /// Statistics about waiting for the status (busy) register to be cleared after transactions
+    struct BusyWaitStatistics {
+      size_t nWaits{0};                          ///< number of completed waits
+      size_t nPolls{0};                          ///< total number of polls resp. checks for updates of busyPush
+      std::chrono::nanoseconds totalWaitTime{0}; ///< sum of all waiting times
+      std::chrono::nanoseconds maxWaitTime{0};   ///< longest waiting time
+    };
+
+    /// Get the statistics about waiting for the status register. Only waits which completed successfully are counted.
+    BusyWaitStatistics getBusyWaitStatistics() const;
+
    protected:
     friend class SubdeviceRegisterAccessor;
     template<typename RegisterRawType, typename WriteDataType>
@@ -139,12 +172,29 @@ namespace ChimeraTK {
     /// operations, in usecs.
     size_t _sleepTime{100};
 
+    /// initial polling interval in usecs, doubled after each poll until _sleepTime is reached
+    size_t _minSleepTime{100};
+
+    /// number of polls without sleeping at the beginning of each wait for the status register
+    size_t _spinCount{0};
+
+    /// optional push-type register replacing the polling of the status register, see class description
+    std::string _busyPushRegister;
+    boost::shared_ptr<NDRegisterAccessor<int32_t>> _accBusyPush;
+
+    /// statistics returned by getBusyWaitStatistics(), protected by _statisticsMutex
+    BusyWaitStatistics _busyWaitStatistics;
+    mutable std::mutex _statisticsMutex;
+
     /// for type == registerWindow, threeRegisters or twoRegisters: sleep time between address and data write
     size_t _addressToDataDelay{0};
 
     /// for type == registerWindow: chip index
     size_t _chipIndex{0};
 
+    /// for type == registerWindow: maximum number of transfers per burst, 0 if burst mode is disabled
+    size_t _burstLength{0};
+
     /// map from register names to addresses
     NumericAddressedRegisterCatalogue _registerMap;
     MetadataCatalogue _metadataCatalogue;
@@ -182,6 +232,19 @@ namespace ChimeraTK {
 
     void activateAsyncRead() noexcept override;
 
+    /// Must be called (with _mutex locked) before starting a transaction which is completed with waitWhileBusy().
+    /// Discards updates of the busyPush register which belong to earlier transactions.
+    void prepareBusyWait();
+
+    /// Wait (with _mutex locked) until the status register is cleared, using the spin/backoff strategy described in the
+    /// class description. readBusy is called to poll the status register, unless busyPush is used. Throws a
+    /// runtime_error on timeout.
+    void waitWhileBusy(const std::function<bool()>& readBusy, const std::string& registerName,
+        const std::string& busyRegisterName);
+
+    /// Sleep between address and data write, if configured
+    void addressToDataDelay() const;
+
     bool needAreaParam() { return _type == Type::area || _type == Type::areaHandshake; }
     bool needStatusParam() { return _type == Type::threeRegisters || _type == Type::areaHandshake; }
 
@@ -68,6 +68,8 @@ namespace ChimeraTK {
     enum class TransferDirection { read, write };
     // Helper for the transfer to minimise code duplication
     void transferImpl(TransferDirection direction);
+    // Wait until the transaction started last has completed (busy flag cleared resp. fixed sleep time)
+    void waitForTransaction();
     std::vector<std::byte> _zeros; // _transferSize bytes with 0 to copy from for padding
   };
 
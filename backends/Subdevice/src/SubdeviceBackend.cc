@@ -155,8 +155,22 @@ namespace ChimeraTK {
                 parameters["chipIndex"] + "': " + e.what());
           }
         }
+
+        // The burst mode is optional.
+        if(!parameters["burst"].empty()) {
+          try {
+            _burstLength = std::stoul(parameters["burst"]);
+          }
+          catch(std::exception& e) {
+            throw ChimeraTK::logic_error("SubdeviceBackend: Invalid value for parameter 'burst': '" +
+                parameters["burst"] + "': " + e.what());
+          }
+        }
       }
     }
+    if(_type != Type::registerWindow && !parameters["burst"].empty()) {
+      throw ChimeraTK::logic_error("SubdeviceBackend: Parameter 'burst' is only supported for type 'regWindow'.");
+    }
     if(needStatusParam() && parameters["status"].empty()) {
       throw ChimeraTK::logic_error("SubdeviceBackend: Target status register "
                                    "name must be specified in the device "
@@ -188,6 +202,29 @@ namespace ChimeraTK {
             "SubdeviceBackend: Invalid value for parameter 'sleep': '" + parameters["sleep"] + "': " + e.what());
       }
     }
+    _minSleepTime = _sleepTime;
+    if(!parameters["minSleep"].empty()) {
+      try {
+        _minSleepTime = std::min(size_t(std::stoul(parameters["minSleep"])), _sleepTime);
+      }
+      catch(std::exception& e) {
+        throw ChimeraTK::logic_error("SubdeviceBackend: Invalid value for parameter 'minSleep': '" +
+            parameters["minSleep"] + "': " + e.what());
+      }
+    }
+    if(!parameters["spin"].empty()) {
+      try {
+        _spinCount = std::stoul(parameters["spin"]);
+      }
+      catch(std::exception& e) {
+        throw ChimeraTK::logic_error(
+            "SubdeviceBackend: Invalid value for parameter 'spin': '" + parameters["spin"] + "': " + e.what());
+      }
+    }
+    _busyPushRegister = parameters["busyPush"];
+    if(!_busyPushRegister.empty() && _targetControl.empty()) {
+      throw ChimeraTK::logic_error("SubdeviceBackend: Parameter 'busyPush' requires a status resp. busy register.");
+    }
     // parse map file
     if(parameters["map"].empty()) {
       throw ChimeraTK::logic_error("SubdeviceBackend: Map file must be specified.");
@@ -262,7 +299,7 @@ namespace ChimeraTK {
   /********************************************************************************************************************/
 
   RegisterCatalogue SubdeviceBackend::getRegisterCatalogue() const {
-    return RegisterCatalogue(_registerMap.clone());
+    return RegisterCatalogue(_registerMap.getSnapshot());
   }
 
   /********************************************************************************************************************/
@@ -277,6 +314,13 @@ namespace ChimeraTK {
   boost::shared_ptr<NDRegisterAccessor<UserType>> SubdeviceBackend::getRegisterAccessor_impl(
       const RegisterPath& registerPathName, size_t numberOfWords, size_t wordOffsetInRegister, AccessModeFlags flags) {
     obtainTargetBackend();
+    if(!_busyPushRegister.empty()) {
+      std::lock_guard<std::mutex> lock(*_mutex);
+      if(!_accBusyPush) {
+        _accBusyPush = _targetDevice->getRegisterAccessor<int32_t>(
+            _busyPushRegister, 1, 0, {AccessMode::wait_for_new_data});
+      }
+    }
     boost::shared_ptr<NDRegisterAccessor<UserType>> returnValue;
     if(_type == Type::area) {
       returnValue = getAreaRegisterAccessor<UserType>(registerPathName, numberOfWords, wordOffsetInRegister, flags);
@@ -585,6 +629,73 @@ namespace ChimeraTK {
     obtainTargetBackend();
     _targetDevice->activateAsyncRead();
   }
+
+  /********************************************************************************************************************/
+
+  void SubdeviceBackend::prepareBusyWait() {
+    if(_accBusyPush) {
+      _accBusyPush->readLatest();
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void SubdeviceBackend::waitWhileBusy(const std::function<bool()>& readBusy, const std::string& registerName,
+      const std::string& busyRegisterName) {
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::milliseconds(_timeout);
+    size_t sleepTime = _minSleepTime;
+    size_t nPolls = 0;
+    bool gotPushUpdate = false;
+    while(true) {
+      // spin first, then sleep with exponentially growing intervals up to _sleepTime
+      if(nPolls >= _spinCount) {
+        usleep(sleepTime);
+        sleepTime = std::min(std::max(2 * sleepTime, size_t(1)), _sleepTime);
+      }
+      ++nPolls;
+
+      bool busy;
+      if(_accBusyPush) {
+        // Only an update received after the transaction has been started can signal its completion.
+        gotPushUpdate |= _accBusyPush->readLatest();
+        busy = !gotPushUpdate || _accBusyPush->accessData(0) != 0;
+      }
+      else {
+        busy = readBusy();
+      }
+      if(!busy) {
+        break;
+      }
+      if(std::chrono::steady_clock::now() > deadline) {
+        throw ChimeraTK::runtime_error("Write to register '" + registerName +
+            "' failed: timeout waiting for cleared busy flag (" + busyRegisterName + ")");
+      }
+    }
+
+    auto waitTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::lock_guard<std::mutex> lock(_statisticsMutex);
+    ++_busyWaitStatistics.nWaits;
+    _busyWaitStatistics.nPolls += nPolls;
+    _busyWaitStatistics.totalWaitTime += waitTime;
+    _busyWaitStatistics.maxWaitTime = std::max(_busyWaitStatistics.maxWaitTime, waitTime);
+  }
+
+  /********************************************************************************************************************/
+
+  void SubdeviceBackend::addressToDataDelay() const {
+    if(_addressToDataDelay > 0) {
+      usleep(_addressToDataDelay);
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  SubdeviceBackend::BusyWaitStatistics SubdeviceBackend::getBusyWaitStatistics() const {
+    std::lock_guard<std::mutex> lock(_statisticsMutex);
+    return _busyWaitStatistics;
+  }
+
   /********************************************************************************************************************/
 
   std::set<DeviceBackend::BackendID> SubdeviceBackend::getInvolvedBackendIDs() {
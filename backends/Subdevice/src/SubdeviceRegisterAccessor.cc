@@ -51,7 +51,7 @@ namespace ChimeraTK {
         if(_backend->_type != SubdeviceBackend::Type::areaHandshake) {
           _accAddress->accessData(0) = static_cast<int32_t>(adr);
           _accAddress->write();
-          usleep(_backend->_addressToDataDelay);
+          _backend->addressToDataDelay();
         }
 
         // write data register
@@ -68,25 +68,21 @@ namespace ChimeraTK {
             ++idx;
           }
         }
+        if(_backend->needStatusParam()) {
+          _backend->prepareBusyWait();
+        }
         _accDataArea->write();
 
         // wait until transaction is complete
         if(_backend->_type == SubdeviceBackend::Type::threeRegisters ||
             _backend->_type == SubdeviceBackend::Type::areaHandshake) {
           // for 3regs/areaHandshake, wait until status register is 0 again
-          size_t retry = 0;
-          size_t max_retry = _backend->_timeout * 1000 / _backend->_sleepTime;
-          while(true) {
-            usleep(_backend->_sleepTime);
-            _accStatus->read();
-            if(_accStatus->accessData(0) == 0) {
-              break;
-            }
-            if(++retry > max_retry) {
-              throw ChimeraTK::runtime_error("Write to register '" + _name +
-                  "' failed: timeout waiting for cleared busy flag (" + _accStatus->getName() + ")");
-            }
-          }
+          _backend->waitWhileBusy(
+              [&] {
+                _accStatus->read();
+                return _accStatus->accessData(0) != 0;
+              },
+              _name, _accStatus->getName());
         }
         else {
           // for 2regs, wait given time
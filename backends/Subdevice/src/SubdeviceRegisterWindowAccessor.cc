@@ -99,8 +99,15 @@ namespace ChimeraTK {
         _accChipSelect.setAndWrite(_backend->_chipIndex);
       }
 
+      // In burst mode, the address is written only once per burst. The firmware increments the address after each
+      // access to the data registers. Without burst mode, each burst consists of a single transfer.
+      size_t burstLength = std::max(_backend->_burstLength, size_t(1));
+
       size_t bufferCopyOffset = 0;
       for(size_t adr = _starTransferAddress; adr < _endTransferAddress; ++adr) {
+        bool isFirstInBurst = (adr - _starTransferAddress) % burstLength == 0;
+        bool isLastInBurst = (adr + 1 - _starTransferAddress) % burstLength == 0 || adr + 1 == _endTransferAddress;
+
         // copy data between buffer and read/write data accessor
         auto thisTransfersStartAddress = adr * _transferSize;
         auto thisTransfersEndAddress = thisTransfersStartAddress + _transferSize;
@@ -115,9 +122,11 @@ namespace ChimeraTK {
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
         auto* bufferStart = reinterpret_cast<std::byte*>(_buffer.data());
 
-        // set the transfer address before starting the read/write transaction
-        _accAddress.setAndWrite(adr);
-        usleep(_backend->_addressToDataDelay); // FIXME: Do we still need this?
+        if(isFirstInBurst) {
+          // set the transfer address before starting the read/write transaction
+          _accAddress.setAndWrite(adr);
+          _backend->addressToDataDelay(); // FIXME: Do we still need this?
+        }
 
         if(direction == TransferDirection::write) {
           // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -138,35 +147,28 @@ namespace ChimeraTK {
                 thisTransfersEndAddress - copyEndAddress);
           }
 
-          _accWriteData.write();
+          if(isLastInBurst) {
+            if(_accBusy.isInitialised()) {
+              _backend->prepareBusyWait();
+            }
+            _accWriteData.write();
+            waitForTransaction();
+          }
+          else {
+            _accWriteData.write();
+          }
         }
         else {
           assert(direction == TransferDirection::read);
-          _accReadRequest.write();
-        }
-
-        // wait until transaction is complete
-        if(_accBusy.isInitialised()) {
-          // for 3regs/regWindow wait until status register is 0 again
-          size_t retry = 0;
-          size_t max_retry = _backend->_timeout * 1000 / _backend->_sleepTime;
-          while(true) {
-            usleep(_backend->_sleepTime);
-            if(!_accBusy.readAndGet()) {
-              break;
-            }
-            if(++retry > max_retry) {
-              throw ChimeraTK::runtime_error("Write to register '" + this->_name +
-                  "' failed: timeout waiting for cleared busy flag (" + _accBusy.getName() + ")");
+          if(isFirstInBurst) {
+            // a single read request fetches the data for the entire burst
+            if(_accBusy.isInitialised()) {
+              _backend->prepareBusyWait();
             }
+            _accReadRequest.write();
+            waitForTransaction();
           }
-        }
-        else {
-          // for 2regs, wait given time
-          usleep(_backend->_sleepTime);
-        }
 
-        if(direction == TransferDirection::read) {
           _accReadData.read();
           // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
           auto* accessorStart = reinterpret_cast<std::byte*>(_accReadData.data());
@@ -184,6 +186,20 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  template<typename RegisterRawType, typename WriteDataType>
+  void SubdeviceRegisterWindowAccessor<RegisterRawType, WriteDataType>::waitForTransaction() {
+    if(_accBusy.isInitialised()) {
+      // for 3regs/regWindow wait until status register is 0 again
+      _backend->waitWhileBusy([&] { return bool(_accBusy.readAndGet()); }, this->_name, _accBusy.getName());
+    }
+    else {
+      // for 2regs, wait given time
+      usleep(_backend->_sleepTime);
+    }
+  }
+
+  /********************************************************************************************************************/
+
   template<typename RegisterRawType, typename WriteDataType>
   void SubdeviceRegisterWindowAccessor<RegisterRawType, WriteDataType>::doPreRead(TransferType) {
     if(!_backend->isOpen()) {
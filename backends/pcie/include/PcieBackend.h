@@ -2,12 +2,16 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #pragma once
 
+#include "async/InterruptEventFile.h"
 #include "NumericAddressedBackend.h"
+#include "PcieMappedBars.h"
 
 #include <boost/function.hpp>
 
 #include <cstdint>
 #include <cstdlib>
+#include <map>
+#include <mutex>
 
 namespace ChimeraTK {
 
@@ -55,10 +59,31 @@ namespace ChimeraTK {
 
     bool checkConnection() const;
 
+    /// Flag whether the BARs shall be mapped into the user space (CDD parameter "mmap=1").
+    bool _useMmap;
+
+    /// The BARs mapped into the user space, only used if _useMmap is set
+    PcieMappedBars _mappedBars;
+
+    /** Read through the mapped BARs. Returns false if the range is not mapped. */
+    bool mmapRead(uint8_t bar, uint32_t address, int32_t* data, size_t sizeInBytes);
+
+    /// Prefix of the event files signalling interrupts. The interrupt number is appended to obtain the file name.
+    /// Empty if interrupts are not configured.
+    std::string _eventFilePrefix;
+
+    /// Event files for the active interrupts, by interrupt number
+    std::map<uint32_t, std::unique_ptr<async::InterruptEventFile>> _eventFiles;
+    mutable std::mutex _eventFilesMutex;
+
+    /// Stop all event threads and close the event files
+    void stopEventThreads();
+
     /** constructor called through createInstance to create device object */
 
    public:
-    explicit PcieBackend(std::string deviceNodeName, const std::string& mapFileName = "");
+    explicit PcieBackend(std::string deviceNodeName, const std::string& mapFileName = "", bool useMmap = false,
+        std::string eventFilePrefix = "");
     ~PcieBackend() override;
 
     void open() override;
@@ -69,8 +94,30 @@ namespace ChimeraTK {
 
     std::string readDeviceInfo() override;
 
-    /*Host or parameters (at least for now) are just place holders as pcidevice
-     * does not use them*/
+    /**
+     * Start the thread distributing the given interrupt. The interrupt is signalled through the event file
+     * "<eventFilePrefix><interruptNumber>", see async::InterruptEventFile for the protocol. If no eventFilePrefix has
+     * been configured, an exception is reported through setException().
+     */
+    std::future<void> activateSubscription(
+        uint32_t interruptNumber, boost::shared_ptr<async::DomainImpl<std::nullptr_t>> asyncDomain) override;
+
+    /**
+     * Return the number of interrupts which have been signalled by the driver but were not distributed separately,
+     * because they occurred before the previous interrupt has been handled. Returns 0 if the interrupt is not active.
+     */
+    [[nodiscard]] uint64_t getMissedInterruptCount(uint32_t interruptNumber) const;
+
+    /** Create backend instance. Supported parameters besides "map" and the merge policy of the
+     *  NumericAddressedBackend:
+     *  - "mmap": if set to "1", the BARs 0 to 5 are mapped into the user space and register accesses are performed
+     *    with plain loads and stores instead of system calls. Falls back to the driver access for any BAR which cannot
+     *    be mapped. The default is "0".
+     *  - "eventFilePrefix": prefix of the files signalling the interrupts, to which the interrupt number is appended,
+     *    e.g. "/dev/mydevice_events" for "/dev/mydevice_events0" etc. The pciedev, llrfdrv and pcieuni drivers do not
+     *    provide such files themselves, so this must point to files provided by a driver extension or a helper
+     *    process, following the protocol described in async::InterruptEventFile (the same as the "events<N>" files of
+     *    the XDMA driver). There is no default, without this parameter interrupts are not supported. */
     static boost::shared_ptr<DeviceBackend> createInstance(
         std::string address, std::map<std::string, std::string> parameters);
   };
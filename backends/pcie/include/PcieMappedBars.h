@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+
+namespace ChimeraTK {
+
+  /**
+   * BARs 0 to 5 of a PCIe device mapped into the user space, used by the PcieBackend with "mmap=1".
+   *
+   * Accesses and (un)mapping are synchronised: unmap() waits until all ongoing accesses are finished, and accesses
+   * after unmap() report that the range is not mapped. Hence closing the backend while other threads are transferring
+   * data never accesses unmapped memory, the transfers fall back to the driver instead (which then reports an error
+   * since the device is closed).
+   */
+  class PcieMappedBars {
+   public:
+    PcieMappedBars() = default;
+    PcieMappedBars(const PcieMappedBars&) = delete;
+    PcieMappedBars& operator=(const PcieMappedBars&) = delete;
+    ~PcieMappedBars() { unmap(); }
+
+    /**
+     * Map the BARs through the files "<resourcePrefix>0" to "<resourcePrefix>5", normally the sysfs resource files of
+     * the PCI device, see getResourcePrefix(). Any BAR which cannot be mapped (e.g. missing permissions or not present)
+     * is silently left unmapped. Previously mapped BARs are unmapped first.
+     */
+    void map(const std::string& resourcePrefix);
+
+    /** Unmap all BARs. Waits until ongoing accesses are finished. */
+    void unmap();
+
+    /**
+     * Return the prefix of the sysfs resource files of the PCI device behind the given open device node, or an empty
+     * string if the file descriptor does not belong to a character device.
+     */
+    static std::string getResourcePrefix(int deviceFileDescriptor);
+
+    /** Check if the given BAR is mapped */
+    [[nodiscard]] bool isMapped(uint8_t bar) const;
+
+    /** Read from a mapped BAR. Returns false without accessing anything if the range is not mapped. */
+    bool read(uint8_t bar, uint32_t address, int32_t* data, size_t sizeInBytes) const;
+
+    /** Write to a mapped BAR. Returns false without accessing anything if the range is not mapped. */
+    bool write(uint8_t bar, uint32_t address, int32_t const* data, size_t sizeInBytes);
+
+   private:
+    /// A mapped BAR. BARs which could not be mapped have a nullptr as base.
+    struct MappedBar {
+      volatile int32_t* base{nullptr};
+      size_t size{0};
+    };
+    std::array<MappedBar, 6> _bars{};
+
+    /// Shared by the accesses, exclusively held while (un)mapping
+    mutable std::shared_mutex _mutex;
+
+    /** Check if the given range lies inside a mapped BAR. Must be called with _mutex held. */
+    [[nodiscard]] bool isMapped(uint8_t bar, uint32_t address, size_t sizeInBytes) const {
+      return bar < _bars.size() && _bars[bar].base != nullptr && address % 4 == 0 && sizeInBytes % 4 == 0 &&
+          address + sizeInBytes <= _bars[bar].size;
+    }
+
+    void unmapUnlocked();
+  };
+
+} // namespace ChimeraTK
@@ -25,9 +25,10 @@
 
 namespace ChimeraTK {
 
-  PcieBackend::PcieBackend(std::string deviceNodeName, const std::string& mapFileName)
+  PcieBackend::PcieBackend(
+      std::string deviceNodeName, const std::string& mapFileName, bool useMmap, std::string eventFilePrefix)
   : NumericAddressedBackend(mapFileName), _deviceID(0), _ioctlPhysicalSlot(0), _ioctlDriverVersion(0), _ioctlDMA(0),
-    _deviceNodeName(std::move(deviceNodeName)) {}
+    _deviceNodeName(std::move(deviceNodeName)), _useMmap(useMmap), _eventFilePrefix(std::move(eventFilePrefix)) {}
 
   PcieBackend::~PcieBackend() {
     close();
@@ -38,7 +39,11 @@ namespace ChimeraTK {
     std::cout << "open pcie dev" << std::endl;
 #endif
     if(_opened) {
-      if(checkConnection()) return;
+      // Only keep the device open if no exception is active. Otherwise re-open it, which also restarts the interrupt
+      // event threads (they terminate when reporting an exception).
+      if(isFunctional() && checkConnection()) return;
+      stopEventThreads();
+      _mappedBars.unmap();
       ::close(_deviceID);
     }
     _deviceID = ::open(_deviceNodeName.c_str(), O_RDWR);
@@ -48,6 +53,10 @@ namespace ChimeraTK {
 
     determineDriverAndConfigureIoctl();
 
+    if(_useMmap) {
+      _mappedBars.map(PcieMappedBars::getResourcePrefix(_deviceID));
+    }
+
     setOpenedAndClearException();
   }
 
@@ -113,7 +122,10 @@ namespace ChimeraTK {
   }
 
   void PcieBackend::closeImpl() {
+    stopEventThreads();
     if(_opened) {
+      // waits for transfers currently accessing the mapped BARs
+      _mappedBars.unmap();
       ::close(_deviceID);
     }
     _opened = false;
@@ -161,6 +173,18 @@ namespace ChimeraTK {
     }
   }
 
+  bool PcieBackend::mmapRead(uint8_t bar, uint32_t address, int32_t* data, size_t sizeInBytes) {
+    if(!_mappedBars.read(bar, address, data, sizeInBytes)) {
+      return false;
+    }
+    // Accesses to the mapped memory do not fail if the device is gone, but reads return all bits set. Only in this
+    // case ask the driver whether the device is still working.
+    if(sizeInBytes >= 4 && data[0] == -1 && !checkConnection()) {
+      throw ChimeraTK::runtime_error("Cannot read data from device: " + _deviceNodeName + ": device not responding");
+    }
+    return true;
+  }
+
   void PcieBackend::writeInternal(uint8_t bar, uint32_t address, int32_t const* data) {
     device_rw l_RW;
     assert(_opened);
@@ -198,6 +222,9 @@ namespace ChimeraTK {
   void PcieBackend::read(uint8_t bar, uint32_t address, int32_t* data, size_t sizeInBytes) {
     checkActiveException();
 
+    if(_useMmap && mmapRead(bar, address, data, sizeInBytes)) {
+      return;
+    }
     if(bar != 0xD) {
       _readFunction(bar, address, data, sizeInBytes);
     }
@@ -217,6 +244,9 @@ namespace ChimeraTK {
   void PcieBackend::write(uint8_t bar, uint32_t address, int32_t const* data, size_t sizeInBytes) {
     checkActiveException();
 
+    if(_useMmap && _mappedBars.write(bar, address, data, sizeInBytes)) {
+      return;
+    }
     _writeFunction(bar, address, data, sizeInBytes);
   }
 
@@ -299,6 +329,62 @@ namespace ChimeraTK {
     return os.str();
   }
 
+  std::future<void> PcieBackend::activateSubscription(
+      uint32_t interruptNumber, boost::shared_ptr<async::DomainImpl<std::nullptr_t>> asyncDomain) {
+    std::promise<void> subscriptionDonePromise;
+    auto subscriptionDoneFuture = subscriptionDonePromise.get_future();
+
+    std::string errorMessage;
+    if(_eventFilePrefix.empty()) {
+      errorMessage = "PcieBackend: cannot use interrupt " + std::to_string(interruptNumber) + " of " + _deviceNodeName +
+          ", no interrupt event files configured (CDD parameter 'eventFilePrefix').";
+    }
+    else {
+      std::lock_guard<std::mutex> lock(_eventFilesMutex);
+      auto& eventFile = _eventFiles[interruptNumber];
+      if(!eventFile) {
+        try {
+          eventFile = std::make_unique<async::InterruptEventFile>(
+              this, _eventFilePrefix + std::to_string(interruptNumber), std::move(asyncDomain));
+        }
+        catch(runtime_error& e) {
+          _eventFiles.erase(interruptNumber);
+          errorMessage = e.what();
+        }
+      }
+      if(errorMessage.empty()) {
+        // does nothing but fulfilling the promise if the thread is already running
+        _eventFiles[interruptNumber]->startThread(std::move(subscriptionDonePromise));
+        return subscriptionDoneFuture;
+      }
+    }
+
+    // report the exception without holding the lock
+    setException(errorMessage);
+    subscriptionDonePromise.set_value();
+    return subscriptionDoneFuture;
+  }
+
+  uint64_t PcieBackend::getMissedInterruptCount(uint32_t interruptNumber) const {
+    std::lock_guard<std::mutex> lock(_eventFilesMutex);
+    auto it = _eventFiles.find(interruptNumber);
+    if(it == _eventFiles.end()) {
+      return 0;
+    }
+    return it->second->getMissedInterruptCount();
+  }
+
+  void PcieBackend::stopEventThreads() {
+    // Move the event files out of the map first: joining the threads must not happen while holding the lock, since
+    // the threads might report exceptions to the backend.
+    decltype(_eventFiles) eventFiles;
+    {
+      std::lock_guard<std::mutex> lock(_eventFilesMutex);
+      eventFiles.swap(_eventFiles);
+    }
+    eventFiles.clear();
+  }
+
   std::string PcieBackend::createErrorStringWithErrnoText(std::string const& startText) {
     char errorBuffer[255];
     return startText + _deviceNodeName + ": " + strerror_r(errno, errorBuffer, sizeof(errorBuffer));
@@ -312,7 +398,19 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("Device address not specified.");
     }
 
-    return boost::shared_ptr<DeviceBackend>(new PcieBackend("/dev/" + address, parameters["map"]));
+    bool useMmap = false;
+    if(auto it = parameters.find("mmap"); it != parameters.end()) {
+      if(it->second != "0" && it->second != "1") {
+        throw ChimeraTK::logic_error("PcieBackend: Invalid value for parameter 'mmap': '" + it->second + "'");
+      }
+      useMmap = (it->second == "1");
+    }
+
+    auto backend = boost::shared_ptr<PcieBackend>(
+        new PcieBackend("/dev/" + address, parameters["map"], useMmap, parameters["eventFilePrefix"]));
+    backend->setMergePolicy(parameters);
+    backend->setAsyncDistributionPolicy(parameters);
+    return backend;
   }
 
 } // namespace ChimeraTK
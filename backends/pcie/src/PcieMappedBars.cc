@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "PcieMappedBars.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <mutex>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  std::string PcieMappedBars::getResourcePrefix(int deviceFileDescriptor) {
+    // Find the PCI device in sysfs through the device number of the device node. This works independent of the driver.
+    struct stat nodeStat {};
+    if(::fstat(deviceFileDescriptor, &nodeStat) != 0 || !S_ISCHR(nodeStat.st_mode)) {
+      return {};
+    }
+    return "/sys/dev/char/" + std::to_string(major(nodeStat.st_rdev)) + ":" + std::to_string(minor(nodeStat.st_rdev)) +
+        "/device/resource";
+  }
+
+  /********************************************************************************************************************/
+
+  void PcieMappedBars::map(const std::string& resourcePrefix) {
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    unmapUnlocked();
+    if(resourcePrefix.empty()) {
+      return;
+    }
+
+    for(size_t bar = 0; bar < _bars.size(); ++bar) {
+      int resourceFile = ::open((resourcePrefix + std::to_string(bar)).c_str(), O_RDWR | O_SYNC);
+      if(resourceFile < 0) {
+        continue;
+      }
+      struct stat resourceStat {};
+      if(::fstat(resourceFile, &resourceStat) != 0 || resourceStat.st_size <= 0) {
+        ::close(resourceFile);
+        continue;
+      }
+      auto size = static_cast<size_t>(resourceStat.st_size);
+      void* mem = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, resourceFile, 0);
+      // the mapping stays valid after closing the file
+      ::close(resourceFile);
+      if(mem == MAP_FAILED) {
+        continue;
+      }
+#ifdef _DEBUG
+      std::cout << "PCIe: mapped " << size << " bytes of bar " << bar << std::endl;
+#endif
+      _bars[bar] = {static_cast<volatile int32_t*>(mem), size};
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void PcieMappedBars::unmap() {
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    unmapUnlocked();
+  }
+
+  /********************************************************************************************************************/
+
+  void PcieMappedBars::unmapUnlocked() {
+    for(auto& mappedBar : _bars) {
+      if(mappedBar.base != nullptr) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        ::munmap(const_cast<int32_t*>(mappedBar.base), mappedBar.size);
+      }
+      mappedBar = {};
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  bool PcieMappedBars::isMapped(uint8_t bar) const {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    return bar < _bars.size() && _bars[bar].base != nullptr;
+  }
+
+  /********************************************************************************************************************/
+
+  bool PcieMappedBars::read(uint8_t bar, uint32_t address, int32_t* data, size_t sizeInBytes) const {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    if(!isMapped(bar, address, sizeInBytes)) {
+      return false;
+    }
+    const volatile int32_t* source = _bars[bar].base + address / 4;
+    for(size_t i = 0; i < sizeInBytes / 4; ++i) {
+      data[i] = source[i];
+    }
+    return true;
+  }
+
+  /********************************************************************************************************************/
+
+  bool PcieMappedBars::write(uint8_t bar, uint32_t address, int32_t const* data, size_t sizeInBytes) {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    if(!isMapped(bar, address, sizeInBytes)) {
+      return false;
+    }
+    volatile int32_t* target = _bars[bar].base + address / 4;
+    for(size_t i = 0; i < sizeInBytes / 4; ++i) {
+      target[i] = data[i];
+    }
+    return true;
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -6,29 +6,56 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ChimeraTK {
   /// @brief Implements a generic userspace interface for UIO devices.
   class UioAccess {
    private:
+    /// @brief Memory region of the UIO device, as listed in /sys/class/uio/uioN/maps/mapM.
+    struct MemoryMap {
+      /// Physical start address of the region
+      uint64_t kernelBase = 0;
+      /// Size of the region in bytes
+      size_t size = 0;
+      /// Start and size of the mmap'ed range. The region starts at an offset within the first page.
+      void* mmapBase = nullptr;
+      size_t mmapSize = 0;
+      /// Start of the region in user space
+      volatile int32_t* userBase = nullptr;
+    };
+
     std::filesystem::path _deviceFilePath;
+    std::filesystem::path _sysfsPath;
     int _deviceFileDescriptor = 0;
-    void* _deviceUserBase = nullptr;
-    void* _deviceKernelBase = nullptr;
-    size_t _deviceMemSize = 0;
+    std::vector<MemoryMap> _maps;
+    std::atomic<size_t> _numberOfMaps{0};
     uint32_t _lastInterruptCount = 0;
     std::atomic<bool> _opened{false};
 
-    /// @brief Maps user space memory range to address range of UIO device.
+    /// @brief Resolves the UIO device name and reads the memory regions of the device from sysfs. Leaves the list of
+    /// regions empty if the device does not exist.
+    /// @return Name of the UIO device in sysfs (e.g. uio0)
+    std::string readMaps();
+
+    /// @brief Maps user space memory ranges to all address ranges of UIO device.
     void UioMMap();
 
-    /// @brief Unmaps user space memory range for address range of UIO device.
+    /// @brief Unmaps user space memory ranges for address ranges of UIO device.
     void UioUnmap();
 
+    /// @brief Returns the user space pointer to the given address in the given map, after checking the range.
+    /// @param map Selected UIO memory region
+    /// @param address Start address of the access, relative to the region or absolute bus address
+    /// @param sizeInBytes Number of bytes to access
+    /// @param accessType "Read" or "Write", used in error messages
+    /// @return Pointer to the start of the access
+    volatile int32_t* getUserPointer(uint64_t map, uint64_t address, size_t sizeInBytes, const char* accessType);
+
     /// @brief Looks up UIO device file name (e.g. uio0) from device tree node name.
     /// @param dtNodeName Device tree node name
     /// @return UIO device file name or empty string
-    static std::string lookupUioDevFromDtNode(const std::string dtNodeNname);
+    std::string lookupUioDevFromDtNode(const std::string& dtNodeName);
 
     /// @brief Subtracts uint32_t values taking overflow into account.
     /// @param minuend Minuend of subtraction
@@ -47,7 +74,10 @@ namespace ChimeraTK {
     uint64_t readUint64HexFromFile(std::string fileName);
 
    public:
-    explicit UioAccess(const std::string& deviceFilePath);
+    /// @brief Determines the memory regions of the device from sysfs, so getNumberOfMaps() is valid before open().
+    /// @param deviceFilePath Path of the device file, or device tree node name prefixed with "/dev/"
+    /// @param sysfsPath Directory containing the sysfs entries of all UIO devices
+    explicit UioAccess(const std::string& deviceFilePath, std::filesystem::path sysfsPath = "/sys/class/uio");
     ~UioAccess();
 
     /// @brief Opens UIO device for read and write operations and interrupt handling.
@@ -57,14 +87,14 @@ namespace ChimeraTK {
     void close();
 
     /// @brief Read data from the specified memory offset address. The address range starts at '0'.
-    /// @param map Selected UIO memory region. Only region '0' is currently supported.
+    /// @param map Selected UIO memory region (mapN of the UIO device)
     /// @param address Start address of memory to read from
     /// @param data Address pointer to which data is to be copied
     /// @param sizeInBytes Number of bytes to copy
     void read(uint64_t map, uint64_t address, int32_t* data, size_t sizeInBytes);
 
     /// @brief Write data to the specified memory offset address. The address range starts at '0'.
-    /// @param map Selected UIO memory region. Only region '0' is currently supported.
+    /// @param map Selected UIO memory region (mapN of the UIO device)
     /// @param address Start address of memory to write to
     /// @param data Address pointer from which data is to be copied
     /// @param sizeInBytes Number of bytes to copy
@@ -78,6 +108,10 @@ namespace ChimeraTK {
     /// @brief Clear all pending interrupts.
     void clearInterrupts();
 
+    /// @brief Return number of memory regions of the UIO device, as found in sysfs at construction or in open().
+    /// @return Number of memory regions, 0 if the device does not exist
+    size_t getNumberOfMaps() const;
+
     /// @brief Return UIO device file path.
     /// @return File path
     std::string getDeviceFilePath();
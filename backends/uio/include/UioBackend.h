@@ -22,6 +22,10 @@ namespace ChimeraTK {
    public:
     UioBackend(
         const std::string& deviceName, const std::string& mapFileName, const std::string& dataConsistencyKeyDescriptor);
+
+    /// Create the backend with the given UioAccess, e.g. using a different sysfs location for tests.
+    UioBackend(std::shared_ptr<UioAccess> uioAccess, const std::string& mapFileName,
+        const std::string& dataConsistencyKeyDescriptor = "");
     ~UioBackend() override;
 
     static boost::shared_ptr<DeviceBackend> createInstance(
@@ -9,23 +9,29 @@
 
 #include <fcntl.h>
 #include <poll.h>
+#include <unistd.h>
 
 #include <cerrno>
 #include <cstring>
 #include <fstream>
 #include <limits>
+#include <utility>
 
 namespace ChimeraTK {
 
-  UioAccess::UioAccess(const std::string& deviceFilePath) : _deviceFilePath(deviceFilePath.c_str()) {}
+  UioAccess::UioAccess(const std::string& deviceFilePath, std::filesystem::path sysfsPath)
+  : _deviceFilePath(deviceFilePath.c_str()), _sysfsPath(std::move(sysfsPath)) {
+    readMaps();
+    _numberOfMaps = _maps.size();
+  }
 
   UioAccess::~UioAccess() {
     close();
   }
 
-  std::string UioAccess::lookupUioDevFromDtNode(const std::string dtNodeNname) {
-    std::string path = "/sys/class/uio/";
-    for(const auto& entry : std::filesystem::directory_iterator(path)) {
+  std::string UioAccess::lookupUioDevFromDtNode(const std::string& dtNodeName) {
+    std::error_code ec;
+    for(const auto& entry : std::filesystem::directory_iterator(_sysfsPath, ec)) {
       std::ifstream ifs{entry.path() / "name"};
       if(!ifs) {
         continue;
@@ -33,27 +39,48 @@ namespace ChimeraTK {
 
       std::string currentName;
       ifs >> currentName;
-      if(currentName == dtNodeNname) {
+      if(currentName == dtNodeName) {
         return entry.path().filename();
       }
     }
     return "";
   }
 
-  void UioAccess::open() {
-    if(std::filesystem::is_symlink(_deviceFilePath)) {
-      _deviceFilePath = std::filesystem::canonical(_deviceFilePath);
+  std::string UioAccess::readMaps() {
+    std::error_code ec;
+    if(std::filesystem::is_symlink(_deviceFilePath, ec)) {
+      _deviceFilePath = std::filesystem::canonical(_deviceFilePath, ec);
     }
     std::string fileName = _deviceFilePath.filename().string();
     std::string resolvedUioDev = lookupUioDevFromDtNode(fileName);
     if(!resolvedUioDev.empty()) {
       fileName = resolvedUioDev;
-      _deviceFilePath = "/dev/" + fileName;
+      _deviceFilePath = _deviceFilePath.parent_path() / fileName;
     }
 
-    _deviceKernelBase = (void*)readUint64HexFromFile("/sys/class/uio/" + fileName + "/maps/map0/addr");
-    _deviceMemSize = readUint64HexFromFile("/sys/class/uio/" + fileName + "/maps/map0/size");
-    _lastInterruptCount = readUint32FromFile("/sys/class/uio/" + fileName + "/event");
+    _maps.clear();
+    for(size_t i = 0;; ++i) {
+      auto mapPath = (_sysfsPath / fileName / "maps" / ("map" + std::to_string(i))).string();
+      if(!std::filesystem::exists(mapPath, ec)) {
+        break;
+      }
+      MemoryMap map;
+      map.kernelBase = readUint64HexFromFile(mapPath + "/addr");
+      map.size = readUint64HexFromFile(mapPath + "/size");
+      // offset of the region within the first page (only present for newer kernels)
+      map.mmapSize = map.size + readUint64HexFromFile(mapPath + "/offset");
+      _maps.push_back(map);
+    }
+    return fileName;
+  }
+
+  void UioAccess::open() {
+    // Read the regions again, the device might have been re-created since the construction
+    auto fileName = readMaps();
+    if(_maps.empty()) {
+      throw ChimeraTK::runtime_error("UIO: No memory regions found for device '" + getDeviceFilePath() + "'");
+    }
+    _lastInterruptCount = readUint32FromFile((_sysfsPath / fileName / "event").string());
 
     // Open UIO device file here, so that interrupt thread can run before calling open()
     _deviceFileDescriptor = ::open(_deviceFilePath.c_str(), O_RDWR);
@@ -61,6 +88,7 @@ namespace ChimeraTK {
       throw ChimeraTK::runtime_error("UIO: Failed to open device file '" + getDeviceFilePath() + "'");
     }
     UioMMap();
+    _numberOfMaps = _maps.size();
     _opened = true;
   }
 
@@ -72,19 +100,28 @@ namespace ChimeraTK {
     }
   }
 
-  void UioAccess::read(uint64_t map, uint64_t address, int32_t* __restrict__ data, size_t sizeInBytes) {
-    if(map > 0) {
-      throw ChimeraTK::logic_error("UIO: Multiple memory regions are not supported");
+  volatile int32_t* UioAccess::getUserPointer(
+      uint64_t map, uint64_t address, size_t sizeInBytes, const char* accessType) {
+    if(map >= _maps.size()) {
+      throw ChimeraTK::logic_error("UIO: " + std::string(accessType) + " request for non-existing memory region " +
+          std::to_string(map) + " of device '" + getDeviceFilePath() + "'");
     }
+    const auto& region = _maps[map];
 
     // This is a temporary work around, because register nodes of current map use absolute bus addresses.
-    address = address % reinterpret_cast<uint64_t>(_deviceKernelBase);
+    if(address >= region.kernelBase) {
+      address -= region.kernelBase;
+    }
 
-    if(address + sizeInBytes > _deviceMemSize) {
-      throw ChimeraTK::logic_error("UIO: Read request exceeds device memory region");
+    if(sizeInBytes > region.size || address > region.size - sizeInBytes) {
+      throw ChimeraTK::logic_error("UIO: " + std::string(accessType) + " request exceeds device memory region");
     }
 
-    volatile int32_t* rptr = static_cast<volatile int32_t*>(_deviceUserBase) + address / sizeof(int32_t);
+    return region.userBase + address / sizeof(int32_t);
+  }
+
+  void UioAccess::read(uint64_t map, uint64_t address, int32_t* __restrict__ data, size_t sizeInBytes) {
+    volatile int32_t* rptr = getUserPointer(map, address, sizeInBytes, "Read");
     while(sizeInBytes >= sizeof(int32_t)) {
       *(data++) = *(rptr++);
       sizeInBytes -= sizeof(int32_t);
@@ -92,18 +129,7 @@ namespace ChimeraTK {
   }
 
   void UioAccess::write(uint64_t map, uint64_t address, int32_t const* data, size_t sizeInBytes) {
-    if(map > 0) {
-      throw ChimeraTK::logic_error("UIO: Multiple memory regions are not supported");
-    }
-
-    // This is a temporary work around, because register nodes of current map use absolute bus addresses.
-    address = address % reinterpret_cast<uint64_t>(_deviceKernelBase);
-
-    if(address + sizeInBytes > _deviceMemSize) {
-      throw ChimeraTK::logic_error("UIO: Write request exceeds device memory region");
-    }
-
-    volatile int32_t* __restrict__ wptr = static_cast<volatile int32_t*>(_deviceUserBase) + address / sizeof(int32_t);
+    volatile int32_t* __restrict__ wptr = getUserPointer(map, address, sizeInBytes, "Write");
     while(sizeInBytes >= sizeof(int32_t)) {
       *(wptr++) = *(data++);
       sizeInBytes -= sizeof(int32_t);
@@ -157,17 +183,37 @@ namespace ChimeraTK {
     return _deviceFilePath.string();
   }
 
+  size_t UioAccess::getNumberOfMaps() const {
+    return _numberOfMaps;
+  }
+
   void UioAccess::UioMMap() {
-    _deviceUserBase = mmap(NULL, _deviceMemSize, PROT_READ | PROT_WRITE, MAP_SHARED, _deviceFileDescriptor, 0);
-    if(_deviceUserBase == MAP_FAILED) {
-      ::close(_deviceFileDescriptor);
-      throw ChimeraTK::runtime_error("UIO: Cannot allocate memory for UIO device '" + getDeviceFilePath() + "'");
+    // The memory region N is selected by mapping with an offset of N pages
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    for(size_t i = 0; i < _maps.size(); ++i) {
+      auto& map = _maps[i];
+      map.mmapBase = mmap(NULL, map.mmapSize, PROT_READ | PROT_WRITE, MAP_SHARED, _deviceFileDescriptor,
+          static_cast<off_t>(i * pageSize));
+      if(map.mmapBase == MAP_FAILED) {
+        map.mmapBase = nullptr;
+        UioUnmap();
+        ::close(_deviceFileDescriptor);
+        throw ChimeraTK::runtime_error("UIO: Cannot allocate memory for region " + std::to_string(i) +
+            " of UIO device '" + getDeviceFilePath() + "'");
+      }
+      map.userBase =
+          reinterpret_cast<volatile int32_t*>(static_cast<char*>(map.mmapBase) + (map.mmapSize - map.size));
     }
-    return;
   }
 
   void UioAccess::UioUnmap() {
-    munmap(_deviceUserBase, _deviceMemSize);
+    for(auto& map : _maps) {
+      if(map.mmapBase) {
+        munmap(map.mmapBase, map.mmapSize);
+        map.mmapBase = nullptr;
+        map.userBase = nullptr;
+      }
+    }
   }
 
   uint32_t UioAccess::subtractUint32OverflowSafe(uint32_t minuend, uint32_t subtrahend) {
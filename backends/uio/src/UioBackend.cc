@@ -7,10 +7,13 @@ namespace ChimeraTK {
 
   UioBackend::UioBackend(
       const std::string& deviceName, const std::string& mapFileName, const std::string& dataConsistencyKeyDescriptor)
+  : UioBackend(std::make_shared<UioAccess>("/dev/" + deviceName), mapFileName, dataConsistencyKeyDescriptor) {}
+
+  UioBackend::UioBackend(std::shared_ptr<UioAccess> uioAccess, const std::string& mapFileName,
+      const std::string& dataConsistencyKeyDescriptor)
   : NumericAddressedBackend(
-        mapFileName, std::make_unique<NumericAddressedRegisterCatalogue>(), dataConsistencyKeyDescriptor) {
-    _uioAccess = std::make_shared<UioAccess>("/dev/" + deviceName);
-  }
+        mapFileName, std::make_unique<NumericAddressedRegisterCatalogue>(), dataConsistencyKeyDescriptor),
+    _uioAccess(std::move(uioAccess)) {}
 
   UioBackend::~UioBackend() {
     UioBackend::closeImpl();
@@ -28,7 +31,10 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("UIO: No map file name given.");
     }
 
-    return boost::make_shared<UioBackend>(address, parameters["map"], parameters["DataConsistencyKeys"]);
+    auto backend = boost::make_shared<UioBackend>(address, parameters["map"], parameters["DataConsistencyKeys"]);
+    backend->setMergePolicy(parameters);
+    backend->setAsyncDistributionPolicy(parameters);
+    return backend;
   }
 
   void UioBackend::open() {
@@ -57,7 +63,8 @@ namespace ChimeraTK {
   }
 
   bool UioBackend::barIndexValid(uint64_t bar) {
-    return (bar == 0);
+    // The memory regions are known from sysfs already before the device is opened
+    return bar < _uioAccess->getNumberOfMaps();
   }
 
   void UioBackend::read(uint64_t bar, uint64_t address, int32_t* data, size_t sizeInBytes) {
@@ -147,6 +154,7 @@ namespace ChimeraTK {
           std::cout << "dispatching interrupt " << std::endl;
 #endif
 
+          _asyncDomain->reportMissedInterrupts(numberOfInterrupts - 1);
           _asyncDomain->distribute(nullptr);
         }
       }
@@ -4,13 +4,18 @@
 
 #include "CtrlIntf.h"
 #include "DmaIntf.h"
-#include "EventFile.h"
 #include "NumericAddressedBackend.h"
 
+#include "async/DistributionExecutor.h"
+#include "async/InterruptEventFile.h"
+
 #include <boost/core/noncopyable.hpp>
 
 #include <atomic>
+#include <map>
+#include <mutex>
 #include <optional>
+#include <thread>
 #include <vector>
 
 namespace ChimeraTK {
@@ -20,17 +25,61 @@ namespace ChimeraTK {
     static constexpr size_t _maxDmaChannels = 4;
     static constexpr size_t _maxInterrupts = 16;
 
+    /// BAR number of the first DMA channel (by convention)
+    static constexpr uint64_t _firstDmaBar = 13;
+
+    /// Alignment of the parts when splitting DMA reads over several channels
+    static constexpr size_t _dmaPartAlignment = 4096;
+
     std::optional<CtrlIntf> _ctrlIntf;
     std::vector<DmaIntf> _dmaChannels;
-    std::array<std::unique_ptr<EventFile>, _maxInterrupts> _eventFiles;
+    std::array<std::unique_ptr<async::InterruptEventFile>, _maxInterrupts> _eventFiles;
 
     const std::string _devicePath;
 
+    /// Minimum size of each part when splitting DMA reads over several channels. 0 disables splitting.
+    const size_t _dmaSplitSize;
+
+    /// Executes DMA reads on all channels in parallel. Only present while open, if splitting is enabled and there is
+    /// more than one DMA channel.
+    std::unique_ptr<async::DistributionExecutor> _dmaExecutor;
+
+    /// A DMA read transfer (or a part of it)
+    struct DmaTransfer {
+      uint64_t address;
+      int32_t* data;
+      size_t sizeInBytes;
+    };
+
+    /// A read transfer announced through announceRead()
+    struct AnnouncedRead {
+      const void* owner;
+      DmaTransfer transfer;
+      bool done{false};
+    };
+
+    /// Announced DMA reads of each thread. Only access when holding the mutex.
+    std::map<std::thread::id, std::vector<AnnouncedRead>> _announcedReads;
+    std::mutex _announcedReadsMutex;
+
     XdmaIntfAbstract& intfFromBar(uint64_t bar);
 
+    bool isDmaBar(uint64_t bar) const;
+
+    /** Split the given transfers into parts of at least _dmaSplitSize bytes and execute them on all DMA channels in
+     *  parallel. */
+    void readDmaParallel(const std::vector<DmaTransfer>& transfers);
+
+    /** If the given read has been announced by the calling thread, execute all pending announced reads of the calling
+     *  thread together and return true. Return false if the read has not been announced. */
+    bool executeAnnouncedReads(uint64_t address, int32_t* data, size_t sizeInBytes);
+
    public:
+    /** If dmaSplitSize is not 0, DMA reads of at least 2 * dmaSplitSize bytes are split into parts of at least
+     *  dmaSplitSize bytes, which are read through all available DMA channels in parallel. Also the DMA reads of a
+     *  TransferGroup are then distributed over all channels and executed in parallel. */
     explicit XdmaBackend(std::string devicePath, const std::string& mapFileName = "",
-        const std::string& dataConsistencyKeyDescriptor = "");
+        const std::string& dataConsistencyKeyDescriptor = "", size_t dmaSplitSize = 0);
     ~XdmaBackend() override = default;
 
     void open() override;
@@ -40,6 +89,10 @@ namespace ChimeraTK {
     void dump(const int32_t* data, size_t nbytes);
     void read(uint64_t bar, uint64_t address, int32_t* data, size_t sizeInBytes) override;
     void write(uint64_t bar, uint64_t address, const int32_t* data, size_t sizeInBytes) override;
+
+    void announceRead(const void* owner, uint64_t bar, uint64_t address, int32_t* data, size_t sizeInBytes) override;
+    void withdrawTransfers(const void* owner) override;
+
     std::future<void> activateSubscription(
         uint32_t interruptNumber, boost::shared_ptr<async::DomainImpl<std::nullptr_t>> asyncDomain) override;
 
@@ -5,17 +5,18 @@
 
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <iomanip>
 #include <utility>
 
 namespace ChimeraTK {
 
-  XdmaBackend::XdmaBackend(
-      std::string devicePath, const std::string& mapFileName, const std::string& dataConsistencyKeyDescriptor)
+  XdmaBackend::XdmaBackend(std::string devicePath, const std::string& mapFileName,
+      const std::string& dataConsistencyKeyDescriptor, size_t dmaSplitSize)
   : NumericAddressedBackend(
         mapFileName, std::make_unique<NumericAddressedRegisterCatalogue>(), dataConsistencyKeyDescriptor),
-    _devicePath(std::move(devicePath)) {}
+    _devicePath(std::move(devicePath)), _dmaSplitSize(dmaSplitSize) {}
 
   void XdmaBackend::open() {
 #ifdef _DEBUG
@@ -42,6 +43,12 @@ namespace ChimeraTK {
       }
     }
 
+    // The calling thread takes part in the work, so one thread less than channels is needed
+    _dmaExecutor.reset();
+    if(_dmaSplitSize > 0 && _dmaChannels.size() > 1) {
+      _dmaExecutor = std::make_unique<async::DistributionExecutor>(_dmaChannels.size() - 1);
+    }
+
 #ifdef _DEBUG
     std::cout << "XDMA: opened interface with " << _dmaChannels.size() << " DMA channels and " << _eventFiles.size()
               << " interrupt sources\n";
@@ -52,7 +59,12 @@ namespace ChimeraTK {
   void XdmaBackend::closeImpl() {
     std::ranges::for_each(_eventFiles, [](auto& eventFile) { eventFile = nullptr; });
     _ctrlIntf.reset();
+    _dmaExecutor.reset();
     _dmaChannels.clear();
+    {
+      std::lock_guard<std::mutex> lock(_announcedReadsMutex);
+      _announcedReads.clear();
+    }
     _opened = false;
   }
 
@@ -66,8 +78,8 @@ namespace ChimeraTK {
     }
     // 13 is magic value for DMA channel (by convention)
     // We provide N DMA channels starting from there
-    if(bar >= 13) {
-      const size_t dmaChIdx = bar - 13;
+    if(bar >= _firstDmaBar) {
+      const size_t dmaChIdx = bar - _firstDmaBar;
       if(dmaChIdx < _dmaChannels.size()) {
         return _dmaChannels[dmaChIdx];
       }
@@ -75,6 +87,10 @@ namespace ChimeraTK {
     throw ChimeraTK::runtime_error("Couldn't find XDMA channel for BAR value " + std::to_string(bar));
   }
 
+  bool XdmaBackend::isDmaBar(uint64_t bar) const {
+    return bar >= _firstDmaBar && bar - _firstDmaBar < _dmaChannels.size();
+  }
+
 #ifdef _DEBUG
   void XdmaBackend::dump(const int32_t* data, size_t nbytes) {
     constexpr size_t wordsPerLine = 8;
@@ -99,6 +115,16 @@ namespace ChimeraTK {
     std::cout << "XDMA: read " << sizeInBytes << " bytes @ BAR" << bar << ", 0x" << std::hex << address << std::endl;
 #endif
     auto& intf = intfFromBar(bar);
+    if(_dmaExecutor && isDmaBar(bar)) {
+      // All DMA channels access the same AXI MM address space, so any channel can serve any part of the read
+      if(executeAnnouncedReads(address, data, sizeInBytes)) {
+        return;
+      }
+      if(sizeInBytes >= 2 * _dmaSplitSize) {
+        readDmaParallel({{address, data, sizeInBytes}});
+        return;
+      }
+    }
     intf.read(address, data, sizeInBytes);
 #ifdef _DEBUGDUMP
     dump(data, sizeInBytes);
@@ -116,6 +142,101 @@ namespace ChimeraTK {
 #endif
   }
 
+  void XdmaBackend::announceRead(
+      const void* owner, uint64_t bar, uint64_t address, int32_t* data, size_t sizeInBytes) {
+    if(!_dmaExecutor || !isDmaBar(bar)) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(_announcedReadsMutex);
+    _announcedReads[std::this_thread::get_id()].push_back({owner, {address, data, sizeInBytes}});
+  }
+
+  void XdmaBackend::withdrawTransfers(const void* owner) {
+    if(!_dmaExecutor) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(_announcedReadsMutex);
+    auto it = _announcedReads.find(std::this_thread::get_id());
+    if(it == _announcedReads.end()) {
+      return;
+    }
+    std::erase_if(it->second, [&](const AnnouncedRead& r) { return r.owner == owner; });
+    if(it->second.empty()) {
+      _announcedReads.erase(it);
+    }
+  }
+
+  bool XdmaBackend::executeAnnouncedReads(uint64_t address, int32_t* data, size_t sizeInBytes) {
+    std::vector<DmaTransfer> transfers;
+    {
+      std::lock_guard<std::mutex> lock(_announcedReadsMutex);
+      auto it = _announcedReads.find(std::this_thread::get_id());
+      if(it == _announcedReads.end()) {
+        return false;
+      }
+      auto match = std::ranges::find_if(it->second, [&](const AnnouncedRead& r) {
+        return r.transfer.address == address && r.transfer.data == data && r.transfer.sizeInBytes == sizeInBytes;
+      });
+      if(match == it->second.end()) {
+        return false;
+      }
+      if(match->done) {
+        // already executed together with a previously executed read
+        return true;
+      }
+      for(auto& r : it->second) {
+        if(!r.done) {
+          transfers.push_back(r.transfer);
+          r.done = true;
+        }
+      }
+    }
+
+    // The announcements are only accessed by the calling thread, so the lock is not needed during the transfer
+    try {
+      readDmaParallel(transfers);
+    }
+    catch(...) {
+      // Do not report the other reads as done. They will be executed (and most likely fail) one by one.
+      std::lock_guard<std::mutex> lock(_announcedReadsMutex);
+      auto it = _announcedReads.find(std::this_thread::get_id());
+      if(it != _announcedReads.end()) {
+        std::erase_if(it->second, [](const AnnouncedRead& r) { return r.done; });
+      }
+      throw;
+    }
+    return true;
+  }
+
+  void XdmaBackend::readDmaParallel(const std::vector<DmaTransfer>& transfers) {
+    // Split the transfers into parts and distribute them round robin over the channels
+    std::vector<std::vector<DmaTransfer>> partsPerChannel(_dmaChannels.size());
+    size_t nextChannel = 0;
+    for(const auto& t : transfers) {
+      size_t nParts = std::clamp<size_t>(t.sizeInBytes / _dmaSplitSize, 1, _dmaChannels.size());
+      size_t partSize = (t.sizeInBytes + nParts - 1) / nParts;
+      partSize = (partSize + _dmaPartAlignment - 1) / _dmaPartAlignment * _dmaPartAlignment;
+      for(size_t offset = 0; offset < t.sizeInBytes; offset += partSize) {
+        partsPerChannel[nextChannel].push_back({t.address + offset, t.data + offset / sizeof(int32_t),
+            std::min(partSize, t.sizeInBytes - offset)});
+        nextChannel = (nextChannel + 1) % _dmaChannels.size();
+      }
+    }
+
+    auto readChannel = [&](size_t channel) {
+      for(const auto& part : partsPerChannel[channel]) {
+        _dmaChannels[channel].read(part.address, part.data, part.sizeInBytes);
+      }
+    };
+
+    // Avoid waking up the worker threads if only one channel has something to do
+    if(partsPerChannel[1].empty()) {
+      readChannel(0);
+      return;
+    }
+    _dmaExecutor->run(_dmaChannels.size(), readChannel);
+  }
+
   std::future<void> XdmaBackend::activateSubscription(
       uint32_t interruptNumber, boost::shared_ptr<async::DomainImpl<std::nullptr_t>> asyncDomain) {
     std::promise<void> subscriptionDonePromise;
@@ -128,7 +249,8 @@ namespace ChimeraTK {
     }
 
     if(!_eventFiles[interruptNumber]) {
-      _eventFiles[interruptNumber] = std::make_unique<EventFile>(this, _devicePath, interruptNumber, asyncDomain);
+      _eventFiles[interruptNumber] = std::make_unique<async::InterruptEventFile>(
+          this, _devicePath + "/events" + std::to_string(interruptNumber), asyncDomain);
       _eventFiles[interruptNumber]->startThread(std::move(subscriptionDonePromise));
     }
     else {
@@ -163,7 +285,22 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("XDMA: No map file name given.");
     }
 
-    return boost::make_shared<XdmaBackend>("/dev/" + address, parameters["map"], parameters["DataConsistencyKeys"]);
+    size_t dmaSplitSize = 0;
+    auto it = parameters.find("dmaSplitSize");
+    if(it != parameters.end()) {
+      try {
+        dmaSplitSize = std::stoul(it->second);
+      }
+      catch(std::exception&) {
+        throw ChimeraTK::logic_error("XDMA: Invalid value for parameter 'dmaSplitSize': '" + it->second + "'");
+      }
+    }
+
+    auto backend = boost::make_shared<XdmaBackend>(
+        "/dev/" + address, parameters["map"], parameters["DataConsistencyKeys"], dmaSplitSize);
+    backend->setMergePolicy(parameters);
+    backend->setAsyncDistributionPolicy(parameters);
+    return backend;
   }
 
 } // namespace ChimeraTK
@@ -8,6 +8,11 @@
 #include <boost/make_shared.hpp>
 #include <boost/range/adaptors.hpp>
 
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 namespace ChimeraTK {
 
   template<typename BackendRegisterInfo>
@@ -25,9 +30,9 @@ namespace ChimeraTK {
    public:
     BackendRegisterCatalogueBase() = default;
 
-    BackendRegisterCatalogueBase(BackendRegisterCatalogueBase&& other) = default;
+    BackendRegisterCatalogueBase(BackendRegisterCatalogueBase&& other) noexcept;
 
-    BackendRegisterCatalogueBase& operator=(BackendRegisterCatalogueBase&& other) = default;
+    BackendRegisterCatalogueBase& operator=(BackendRegisterCatalogueBase&& other) noexcept;
 
     virtual ~BackendRegisterCatalogueBase() = default;
 
@@ -81,6 +86,27 @@ namespace ChimeraTK {
         const std::vector<size_t>& qualifiedAsyncDomainId) const;
 
     [[nodiscard]] virtual HiddenRange hiddenRegisters() const = 0;
+
+    /**
+     * Return an immutable copy of the catalogue, e.g. to construct a RegisterCatalogue from it. The copy is created
+     * with clone() on the first call and then shared by all callers until the catalogue is modified, so backends can
+     * hand out RegisterCatalogue objects without copying all register information each time.
+     *
+     * Thread-safe with respect to concurrent calls of getSnapshot(), but not with respect to modifications of the
+     * catalogue.
+     */
+    [[nodiscard]] std::shared_ptr<const BackendRegisterCatalogueBase> getSnapshot() const;
+
+   protected:
+    /**
+     * Discard the snapshot returned by getSnapshot(). Implementations must call this in all functions which modify the
+     * content of the catalogue.
+     */
+    void markModified();
+
+   private:
+    mutable std::mutex _snapshotMutex;
+    mutable std::shared_ptr<const BackendRegisterCatalogueBase> _snapshot;
   };
 
   /********************************************************************************************************************/
@@ -135,8 +161,12 @@ namespace ChimeraTK {
      */
     void modifyRegister(const BackendRegisterInfo& registerInfo);
 
-    /** Return begin iterator for iterating through the registers in the catalogue */
+    /**
+     * Return begin iterator for iterating through the registers in the catalogue. The registers can be modified
+     * through the iterator, hence the snapshot returned by getSnapshot() is discarded.
+     */
     [[nodiscard]] BackendRegisterCatalogueImplIterator<BackendRegisterInfo> begin() {
+      markModified();
       return BackendRegisterCatalogueImplIterator<BackendRegisterInfo>{_iteratedCatalogue.begin()};
     }
 
@@ -188,12 +218,16 @@ namespace ChimeraTK {
     void fillFromThis(BackendRegisterCatalogue<BackendRegisterInfo>* target) const;
 
    private:
+    using CatalogueMap = std::unordered_map<RegisterPath, BackendRegisterInfo>;
+
     // Always access the catalogue through the member functions. Modifications need special care to keep the two
     // containers synchronised, hence these members are made private.
     // The map _catalogue should contain all registers, including "hidden" ones. An exception might be "dynamic"
     // registers which only exist when someone is looking for them (potentially with time-dependent behaviour). Also
     // some backends might still implement "hidden" registers without filling them here.
-    std::map<RegisterPath, BackendRegisterInfo> _catalogue;
+    // The map is hashed by the canonical form of the register path (see RegisterPath::getHash()), so lookups find
+    // registers regardless of the alternative separators of the register name and of the searched name.
+    CatalogueMap _catalogue;
 
     // The _iteratedCatalogue is used to the present the user the registers in a nice way, excluding "hidden" registers.
     // It will be ordered by insertion (call to addRegister()), so e.g. the ordering in the map file can be kept.
@@ -309,12 +343,11 @@ namespace ChimeraTK {
   template<typename BackendRegisterInfo>
   BackendRegisterInfo BackendRegisterCatalogue<BackendRegisterInfo>::getBackendRegister(
       const RegisterPath& name) const {
-    try {
-      return _catalogue.at(name);
-    }
-    catch(std::out_of_range&) {
+    auto it = _catalogue.find(name);
+    if(it == _catalogue.end()) {
       throw ChimeraTK::logic_error("BackendRegisterCatalogue::getRegister(): Register '" + name + "' does not exist.");
     }
+    return it->second;
   }
 
   /********************************************************************************************************************/
@@ -377,6 +410,7 @@ namespace ChimeraTK {
   void BackendRegisterCatalogue<BackendRegisterInfo>::fillFromThis(
       BackendRegisterCatalogue<BackendRegisterInfo>* target) const {
     // copy all registers, including hidden registers
+    target->_catalogue.reserve(_catalogue.size());
     for(auto& p : _catalogue) {
       target->_catalogue[p.first] = getBackendRegister(p.first);
     }
@@ -394,9 +428,10 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("BackendRegisterCatalogue::addRegister(): Register with the name " +
           registerInfo.getRegisterName() + " already exists!");
     }
-    _catalogue[registerInfo.getRegisterName()] = registerInfo;
+    auto& inserted = _catalogue.emplace(registerInfo.getRegisterName(), registerInfo).first->second;
+    markModified();
     if(!registerInfo.isHidden()) {
-      _iteratedCatalogue.push_back(&_catalogue[registerInfo.getRegisterName()]);
+      _iteratedCatalogue.push_back(&inserted);
     }
   }
 
@@ -417,8 +452,8 @@ namespace ChimeraTK {
     _iteratedCatalogue.erase(it);
 
     // remove from catalogue map
-    auto removed = _catalogue.erase(name);
-    assert(removed == 1);
+    _catalogue.erase(_catalogue.find(name));
+    markModified();
   }
 
   /********************************************************************************************************************/
@@ -429,7 +464,8 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("BackendRegisterCatalogue::modifyRegister(): Register '" +
           registerInfo.getRegisterName() + "' cannot be modified because it does not exist!");
     }
-    _catalogue[registerInfo.getRegisterName()] = registerInfo;
+    _catalogue.find(registerInfo.getRegisterName())->second = registerInfo;
+    markModified();
     // We don't have to touch the insertionOrderedCatalogue because is stores references, and this has not changed.
   }
 
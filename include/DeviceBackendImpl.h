@@ -55,6 +55,34 @@ namespace ChimeraTK {
 
     ChimeraTK::VersionNumber getVersionOnOpen() const override;
 
+    /**
+     * Fill and send the data of all async::Domains of this backend with the given number of worker threads, see
+     * async::Domain::setDistributionExecutor(). Reading the data from the device still happens in the thread which has
+     * received the interrupt. 0 (the default) distributes entirely in that thread.
+     */
+    void setAsyncDistributionThreads(size_t nThreads);
+
+    /**
+     * Limit the distribution rate of each async::Domain of this backend to the given number of distributions per
+     * second, see async::Domain::setMinimumDistributionInterval(). Zero (the default) disables the limit.
+     */
+    void setMaximumAsyncDistributionRate(double distributionsPerSecond);
+
+    /**
+     * Set the queue length and overflow policy of the async accessors subscribed from now on, see
+     * async::Domain::setQueuePolicy().
+     */
+    void setAsyncQueuePolicy(const async::QueuePolicy& policy);
+
+    /**
+     * Configure the async distribution from the CDD parameters "distributionThreads" (see
+     * setAsyncDistributionThreads()) and "maxDistributionRate" in Hz (see setMaximumAsyncDistributionRate()), if
+     * present. The queues of the async accessors are configured with "asyncQueueLength", "asyncQueueMaxBytes" and
+     * "asyncQueueOverflow" (one of "overwriteNewest", "dropNewest" and "blockProducer"), see setAsyncQueuePolicy().
+     * This is meant to be called by the createInstance() functions of the backends.
+     */
+    void setAsyncDistributionPolicy(const std::map<std::string, std::string>& parameters);
+
    protected:
     /** Backends should call this function at the end of a (successful) open() call.*/
     void setOpenedAndClearException() noexcept;
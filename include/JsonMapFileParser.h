@@ -25,7 +25,7 @@ namespace ChimeraTK::detail {
      * @param stream input stream to process
      * @return pair of the register catalogue and the metadata catalogue
      */
-    std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> parse(std::ifstream& stream);
+    std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> parse(std::istream& stream);
 
    private:
     struct Imp;
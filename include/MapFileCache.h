@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "MetadataCatalogue.h"
+#include "NumericAddressedRegisterCatalogue.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace ChimeraTK::detail {
+
+  /**
+   * @brief Binary cache for parsed map files
+   *
+   * Stores the register and metadata catalogues obtained from parsing a map file in a compact binary form, so they can
+   * be loaded again without parsing the text file. Cache files are keyed by a hash of the map file content and the
+   * version of this library, so changed map files or parsers lead to parsing again automatically. Cache files are
+   * versioned and only valid for the machine they have been created on (native byte order). Every value read from a
+   * cache file is validated, any invalid file is treated as if no cache file existed.
+   *
+   * Only the content created by the map file parsers is stored. Information added later by the backends (e.g. data
+   * consistency realms) is not part of the cache.
+   */
+  class MapFileCache {
+   public:
+    using Content = std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue>;
+
+    /** Create cache storing its files in the given directory. The directory is created if not existing. */
+    explicit MapFileCache(std::string cacheDirectory);
+
+    /**
+     * Load cached content for the map file with the given name and content. Returns std::nullopt if no valid cache
+     * file exists.
+     */
+    [[nodiscard]] std::optional<Content> load(const std::string& mapFileName, std::string_view mapFileContent) const;
+
+    /**
+     * Store content for the map file with the given name and content. Errors are ignored, since the cache is only an
+     * optimisation. The file is replaced atomically, so concurrent processes never see partially written files.
+     */
+    void store(const std::string& mapFileName, std::string_view mapFileContent, const Content& content) const;
+
+    /** Serialise content into the binary cache format. The hash is stored to identify the map file content. */
+    [[nodiscard]] static std::string serialise(const Content& content, uint64_t contentHash);
+
+    /**
+     * Deserialise content from the binary cache format. Returns std::nullopt if the data is not valid or does not
+     * belong to the given content hash.
+     */
+    [[nodiscard]] static std::optional<Content> deserialise(std::string_view data, uint64_t contentHash);
+
+    /**
+     * Compute a 64 bit FNV-1a hash. The basis can be the hash of preceding data to hash a concatenation without
+     * copying.
+     */
+    [[nodiscard]] static uint64_t hash(std::string_view data, uint64_t basis = 0xcbf29ce484222325ULL);
+
+    /** Compute the key identifying the cache file for the given map file content, see hash(). */
+    [[nodiscard]] static uint64_t getCacheKey(std::string_view mapFileContent);
+
+   private:
+    [[nodiscard]] std::string getCacheFileName(const std::string& mapFileName, uint64_t contentHash) const;
+
+    std::string _cacheDirectory;
+  };
+
+} // namespace ChimeraTK::detail
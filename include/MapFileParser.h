@@ -15,11 +15,27 @@ namespace ChimeraTK {
      * @brief Performs parsing of specified MAP file, resulting in catalogue objects describing all registers and
      * metadata available in file.
      *
+     * If a cache directory is configured (see setCacheDirectory()), the parsed result is stored there in binary form
+     * and re-used when parsing a map file with identical content again.
+     *
      * @throw ChimeraTK::logic_error if parsing error detected or the specified MAP file cannot be opened.
      * @param fileName name of MAP file
      * @return pair of the register catalogue and the metadata catalogue
      */
     static std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> parse(const std::string& fileName);
+
+    /**
+     * @brief Set directory to cache parsed map files in
+     *
+     * Parsed map files are stored in a binary form in this directory, keyed by the content of the map file. This
+     * speeds up the start of applications opening many devices with large map files. An empty string disables the
+     * cache. The default is taken from the environment variable CHIMERATK_MAP_FILE_CACHE_DIR, if set, otherwise the
+     * cache is disabled.
+     */
+    static void setCacheDirectory(const std::string& directory);
+
+    /** Get directory to cache parsed map files in. An empty string means the cache is disabled. */
+    static std::string getCacheDirectory();
   };
 
 } // namespace ChimeraTK
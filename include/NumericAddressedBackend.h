@@ -9,6 +9,8 @@
 
 #include <boost/pointer_cast.hpp>
 
+#include <limits>
+#include <map>
 #include <mutex>
 #include <string>
 
@@ -91,6 +93,81 @@ namespace ChimeraTK {
      */
     virtual size_t minimumTransferAlignment([[maybe_unused]] uint64_t bar) const { return 1; }
 
+    /**
+     * @brief Determines the maximum gap between two address ranges which still allows to merge them
+     *
+     * When merging requests in a TransferGroup, two address ranges in the same bar are merged into a single transfer if
+     * the number of bytes between them does not exceed this value. The gap is read together with the requested data
+     * and thrown away. Writes are still only performed for the originally requested address ranges, so the gap is
+     * never written.
+     *
+     * Reading the gap might have side effects on some hardware (e.g. clear-on-read registers), hence the default
+     * implementation returns the gap configured with setMergePolicy(), which defaults to 0. This means only adjacent or
+     * overlapping address ranges are merged unless configured otherwise. Backends may override this function to
+     * provide a hardware-specific hint.
+     *
+     * @return Maximum gap in bytes
+     */
+    virtual size_t maximumMergeGap([[maybe_unused]] uint64_t bar) const { return _maxMergeGap; }
+
+    /**
+     * @brief Determines the maximum size of a merged transfer
+     *
+     * Two address ranges are not merged into a single transfer if the merged transfer would be bigger than this value
+     * (unless the merged transfer is not bigger than the bigger of the two original transfers). Single transfers are
+     * never split.
+     *
+     * The default implementation returns the size configured with setMergePolicy(), which defaults to no limit.
+     * Backends may override this function to provide a hardware-specific hint (e.g. the maximum DMA transfer size).
+     *
+     * @return Maximum size of a merged transfer in bytes
+     */
+    virtual size_t maximumMergedTransferSize([[maybe_unused]] uint64_t bar) const { return _maxMergedTransferSize; }
+
+    /**
+     * Configure the policy used to merge transfers in a TransferGroup. See maximumMergeGap() and
+     * maximumMergedTransferSize() for the meaning of the parameters. Must be called before accessors are added to a
+     * TransferGroup to have an effect.
+     */
+    void setMergePolicy(size_t maxGap, size_t maxMergedTransferSize = std::numeric_limits<size_t>::max());
+
+    /**
+     * Configure the merge policy from the CDD parameters "maxMergeGap" and "maxMergeSize" (both in bytes), if present.
+     * This is meant to be called by the createInstance() functions of the backends.
+     */
+    void setMergePolicy(const std::map<std::string, std::string>& parameters);
+
+    /**
+     * @brief Announce a read transfer which will be executed later by the same thread
+     *
+     * The NumericAddressedLowLevelTransferElement announces its transfer in preRead() and executes it with read() and
+     * identical arguments in readTransfer(). Inside a TransferGroup, all transfers are announced before the first one
+     * is executed. Backends which can pipeline requests (e.g. over a network link) may use this to execute all
+     * announced transfers of the calling thread together, as soon as the first of them is executed.
+     *
+     * The announcement stays valid until withdrawTransfers() is called with the same owner, which happens in
+     * postRead(), also if the transfer was not executed due to an exception. The data buffer must not be accessed after
+     * that. The default implementation does nothing.
+     */
+    virtual void announceRead([[maybe_unused]] const void* owner, [[maybe_unused]] uint64_t bar,
+        [[maybe_unused]] uint64_t address, [[maybe_unused]] int32_t* data, [[maybe_unused]] size_t sizeInBytes) {}
+
+    /**
+     * @brief Announce a write transfer which will be executed later by the same thread
+     *
+     * Same as announceRead() for writes: The transfer is announced in preWrite() and executed in writeTransfer(). The
+     * data buffer is only guaranteed to contain the final data when the first announced write is executed. The
+     * announcement is withdrawn in postWrite(). The default implementation does nothing.
+     */
+    virtual void announceWrite([[maybe_unused]] const void* owner, [[maybe_unused]] uint64_t bar,
+        [[maybe_unused]] uint64_t address, [[maybe_unused]] int32_t const* data, [[maybe_unused]] size_t sizeInBytes) {}
+
+    /**
+     * Withdraw all transfers of the calling thread announced with the given owner through announceRead() or
+     * announceWrite(). The default implementation does nothing.
+     */
+    virtual void withdrawTransfers([[maybe_unused]] const void* owner) {}
+
     RegisterCatalogue getRegisterCatalogue() const override;
 
     MetadataCatalogue getMetadataCatalogue() const override;
@@ -160,6 +237,10 @@ namespace ChimeraTK {
     /// mutex for protecting unaligned access
     std::mutex _unalignedAccess;
 
+    /// merge policy, see maximumMergeGap() and maximumMergedTransferSize()
+    size_t _maxMergeGap{0};
+    size_t _maxMergedTransferSize{std::numeric_limits<size_t>::max()};
+
     friend NumericAddressedLowLevelTransferElement;
     friend TriggeredPollDistributor;
 
@@ -5,6 +5,7 @@
 #include "Exception.h"
 #include "NDRegisterAccessor.h"
 #include "NumericAddressedBackend.h"
+#include "NumericAddressedLowLevelTransferElement.h"
 #include "NumericAddressedRegisterCatalogue.h"
 #include "RawConverter.h"
 
@@ -20,6 +21,10 @@ namespace ChimeraTK {
   /********************************************************************************************************************/
   /**
    * Implementation of the NDRegisterAccessor for NumericAddressedBackends for multiplexd 2D registers
+   *
+   * The data transfer is performed by a NumericAddressedLowLevelTransferElement, like for the 1D registers. Hence the
+   * transfer can be merged with transfers of neighbouring registers (or other parts of the same area) in a
+   * TransferGroup.
    */
   template<class UserType>
   class NumericAddressedBackendMuxedRegisterAccessor : public NDRegisterAccessor<UserType> {
@@ -43,9 +48,9 @@ namespace ChimeraTK {
         RawConverter::FractionalCase fc, bool isSigned>
     void doPreWriteImpl(RawConverter::Converter<UserType2, RawType, sc, fc, isSigned> converter, size_t channelGroupId);
 
-    void doPreRead(TransferType) override {
-      if(!_ioDevice->isOpen()) throw ChimeraTK::logic_error("Device not opened.");
-    }
+    void doPreRead(TransferType type) override;
+
+    void doPostWrite(TransferType type, VersionNumber versionNumber) override;
 
     [[nodiscard]] bool mayReplaceOther(const boost::shared_ptr<TransferElement const>& other) const override {
       auto rhsCasted = boost::dynamic_pointer_cast<const NumericAddressedBackendMuxedRegisterAccessor<UserType>>(other);
@@ -89,23 +94,49 @@ namespace ChimeraTK {
 
       // offset from beginning of the register to the first sample in the group.
       size_t startOffset{};
+
+      // If all channels in the group are equidistant within a block, this is the distance in bytes between two
+      // adjacent channels of the group. Only such groups can be (de)multiplexed block-wise, see doPostReadImpl().
+      std::ptrdiff_t channelStride{};
+      bool isEquidistant{false};
     };
     std::vector<ChannelGroup> _channelGroups;
 
     /** The device from (/to) which to perform the DMA transfer */
     boost::shared_ptr<NumericAddressedBackend> _ioDevice;
 
-    std::vector<int32_t> _ioBuffer;
+    /** raw accessor performing the actual transfer, possibly shared with other accessors in a TransferGroup */
+    boost::shared_ptr<NumericAddressedLowLevelTransferElement> _rawAccessor;
 
     NumericAddressedRegisterInfo _registerInfo;
 
+    /** Return pointer to the beginning of the (multiplexed) raw data of this accessor */
+    std::byte* rawBegin() {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      return reinterpret_cast<std::byte*>(_rawAccessor->begin(_registerInfo.address));
+    }
+
     std::vector<boost::shared_ptr<TransferElement>> getHardwareAccessingElements() override {
-      return {boost::enable_shared_from_this<TransferElement>::shared_from_this()};
+      return _rawAccessor->getHardwareAccessingElements();
     }
 
-    std::list<boost::shared_ptr<TransferElement>> getInternalElements() override { return {}; }
+    std::list<boost::shared_ptr<TransferElement>> getInternalElements() override {
+      return {_rawAccessor}; // the rawAccessor always returns an empty list
+    }
 
-    void replaceTransferElement(boost::shared_ptr<TransferElement> /*newElement*/) override {} // LCOV_EXCL_LINE
+    void replaceTransferElement(boost::shared_ptr<TransferElement> newElement) override {
+      auto casted = boost::dynamic_pointer_cast<NumericAddressedLowLevelTransferElement>(newElement);
+      if(casted && casted->isMergeable(_rawAccessor)) {
+        casted->mergeWith(*_rawAccessor);
+        _rawAccessor = casted;
+      }
+      _rawAccessor->setExceptionBackend(this->_exceptionBackend);
+    }
+
+    void setExceptionBackend(boost::shared_ptr<DeviceBackend> exceptionBackend) override {
+      this->_exceptionBackend = exceptionBackend;
+      _rawAccessor->setExceptionBackend(exceptionBackend);
+    }
 
     using NDRegisterAccessor<UserType>::buffer_2D;
     using TransferElement::_exceptionBackend;
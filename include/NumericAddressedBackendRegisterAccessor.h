@@ -86,6 +86,14 @@ namespace ChimeraTK {
     /** the backend to use for the actual hardware access */
     boost::shared_ptr<NumericAddressedBackend> _dev;
 
+    /** Spare data buffer for raw accessors, into which the low-level transfer element reads directly if it is not
+     * shared with other accessors and the alignment allows. It is swapped with buffer_2D[0] in doPostRead(), which
+     * saves copying the data. Unused for non-raw accessors. */
+    std::vector<UserType> _directReadBuffer;
+
+    /** Flag whether the current read operation uses _directReadBuffer */
+    bool _isDirectRead{false};
+
     std::vector<boost::shared_ptr<TransferElement>> getHardwareAccessingElements() override;
 
     std::list<boost::shared_ptr<TransferElement>> getInternalElements() override;
@@ -5,6 +5,8 @@
 #include "NumericAddressedBackend.h"
 #include "TransferElement.h"
 
+#include <algorithm>
+
 namespace ChimeraTK {
 
   template<typename UserType, bool isRaw>
@@ -12,6 +14,9 @@ namespace ChimeraTK {
 
   class NumericAddressedBackendASCIIAccessor;
 
+  template<typename UserType>
+  class NumericAddressedBackendMuxedRegisterAccessor;
+
   /********************************************************************************************************************/
   /** Implementation of the NDRegisterAccessor for NumericAddressedBackends,
    * responsible for the underlying raw data access. This accessor is never
@@ -39,19 +44,35 @@ namespace ChimeraTK {
     ~NumericAddressedLowLevelTransferElement() override = default;
 
     void doReadTransferSynchronously() override {
+      auto* target = _directReadTarget != nullptr ? _directReadTarget : rawDataBuffer.data();
       // There is nothing we can do about reinterpet_casting with the C-style interface
       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-      _dev->read(_bar, _startAddress, reinterpret_cast<int32_t*>(rawDataBuffer.data()), _numberOfBytes);
+      _dev->read(_bar, _startAddress, reinterpret_cast<int32_t*>(target), _numberOfBytes);
     }
 
     bool doWriteTransfer(ChimeraTK::VersionNumber) override {
-      // There is nothing we can do about reinterpet_casting with the C-style interface
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-      _dev->write(_bar, _startAddress, reinterpret_cast<int32_t*>(rawDataBuffer.data()), _numberOfBytes);
+      if(_coveredRanges.size() == 1) {
+        // There is nothing we can do about reinterpet_casting with the C-style interface
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _dev->write(_bar, _startAddress, reinterpret_cast<int32_t*>(rawDataBuffer.data()), _numberOfBytes);
+        return false;
+      }
+      // The address ranges have been merged across gaps: only write the requested ranges, never the gaps.
+      for(const auto& [rangeStart, rangeBytes] : _coveredRanges) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _dev->write(_bar, rangeStart, reinterpret_cast<int32_t*>(begin(rangeStart)), rangeBytes);
+      }
       return false;
     }
 
+    void doPreRead(TransferType) override {
+      auto* target = _directReadTarget != nullptr ? _directReadTarget : rawDataBuffer.data();
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      _dev->announceRead(this, _bar, _startAddress, reinterpret_cast<int32_t*>(target), _numberOfBytes);
+    }
+
     void doPostRead(TransferType, bool hasNewData) override {
+      _dev->withdrawTransfers(this);
       if(hasNewData) {
         // it is acceptable to create a new version number only in doPostRead because the LowLevelTransferElement never
         // has wait_for_new_data.
@@ -66,19 +87,24 @@ namespace ChimeraTK {
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
         _dev->read(_bar, _startAddress, reinterpret_cast<int32_t*>(rawDataBuffer.data()), _numberOfBytes);
       }
+      // announce exactly the transfers which will be done in doWriteTransfer()
+      for(const auto& [rangeStart, rangeBytes] : _coveredRanges) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _dev->announceWrite(this, _bar, rangeStart, reinterpret_cast<int32_t*>(begin(rangeStart)), rangeBytes);
+      }
     }
 
     void doPostWrite(TransferType, VersionNumber) override {
+      _dev->withdrawTransfers(this);
       if(_unalignedAccess.owns_lock()) {
         _unalignedAccess.unlock();
       }
     }
 
-    /** Check if the address areas are adjacent and/or overlapping.
-     *  NumericAddressedBackendRegisterAccessor::replaceTransferElement() takes
-     * care of replacing the NumericAddressedBackendRawAccessors with a single
-     * NumericAddressedBackendRawAccessor covering the address space of both
-     * accessors. */
+    /** Check if the address areas are adjacent, overlapping or separated by a gap not bigger than
+     * NumericAddressedBackend::maximumMergeGap(), and whether the merged area does not exceed
+     * NumericAddressedBackend::maximumMergedTransferSize(). mergeWith() takes care of extending this accessor to cover
+     * the address space of both accessors. */
     bool isMergeable(const boost::shared_ptr<TransferElement const>& other) const {
       if(!_dev->canMergeRequests()) return false;
 
@@ -88,12 +114,46 @@ namespace ChimeraTK {
       if(_dev != rhsCasted->_dev) return false;
       if(_bar != rhsCasted->_bar) return false;
 
-      // only allow adjacent and overlapping address areas to be merged
-      if(_startAddress + _numberOfBytes < rhsCasted->_startAddress) return false;
-      if(_startAddress > rhsCasted->_startAddress + rhsCasted->_numberOfBytes) return false;
+      // only allow address areas to be merged which are not separated by more than the maximum gap
+      auto maxGap = _dev->maximumMergeGap(_bar);
+      if(_startAddress + _numberOfBytes + maxGap < rhsCasted->_startAddress) return false;
+      if(_startAddress > rhsCasted->_startAddress + rhsCasted->_numberOfBytes + maxGap) return false;
+
+      // limit the size of the merged transfer, unless the merged area is not bigger than the bigger of the two areas
+      size_t mergedStart = std::min(_startAddress, rhsCasted->_startAddress);
+      size_t mergedEnd =
+          std::max(_startAddress + _numberOfBytes, rhsCasted->_startAddress + rhsCasted->_numberOfBytes);
+      size_t mergedBytes = mergedEnd - mergedStart;
+      if(mergedBytes > _dev->maximumMergedTransferSize(_bar) &&
+          mergedBytes > std::max(_numberOfBytes, rhsCasted->_numberOfBytes)) {
+        return false;
+      }
       return true;
     }
 
+    /** Extend the address range of this accessor to cover the address range of the other accessor as well. The caller
+     * must make sure that isMergeable() returns true for the other accessor. */
+    void mergeWith(const NumericAddressedLowLevelTransferElement& other) {
+      auto coveredRanges = _coveredRanges;
+      coveredRanges.insert(coveredRanges.end(), other._coveredRanges.begin(), other._coveredRanges.end());
+
+      size_t newStartAddress = std::min(_startAddress, other._startAddress);
+      size_t newStopAddress = std::max(_startAddress + _numberOfBytes, other._startAddress + other._numberOfBytes);
+      changeAddress(newStartAddress, newStopAddress - newStartAddress);
+
+      // sort and combine adjacent/overlapping ranges, so only true gaps remain between the covered ranges
+      std::sort(coveredRanges.begin(), coveredRanges.end());
+      _coveredRanges.clear();
+      for(const auto& range : coveredRanges) {
+        if(!_coveredRanges.empty() && _coveredRanges.back().first + _coveredRanges.back().second >= range.first) {
+          auto& last = _coveredRanges.back();
+          last.second = std::max(last.first + last.second, range.first + range.second) - last.first;
+          continue;
+        }
+        _coveredRanges.push_back(range);
+      }
+    }
+
     bool mayReplaceOther(const boost::shared_ptr<TransferElement const>&) const override {
       return false; // never used, since isMergeable() is used instead
     }
@@ -156,6 +216,12 @@ namespace ChimeraTK {
       // Allocated the buffer
       rawDataBuffer.resize(_numberOfBytes);
 
+      // the direct read target (if any) does not match the new address range
+      _directReadTarget = nullptr;
+
+      // the entire (aligned) area is requested
+      _coveredRanges = {{_startAddress, _numberOfBytes}};
+
       // update the name
       _name = "NALLTE:" + std::to_string(_startAddress) + "+" + std::to_string(_numberOfBytes);
     }
@@ -185,6 +251,15 @@ namespace ChimeraTK {
     /** raw buffer */
     std::vector<uint8_t> rawDataBuffer;
 
+    /** If not nullptr, read transfers write the data to this buffer instead of the rawDataBuffer. Only used by a
+     * single accessor owning this element exclusively (i.e. isShared is false), see
+     * NumericAddressedBackendRegisterAccessor::doPreRead(). The buffer must have at least _numberOfBytes bytes. */
+    uint8_t* _directReadTarget{nullptr};
+
+    /** Address ranges (start address and number of bytes) actually requested by the accessors using this element,
+     * sorted by address. Contains more than one entry only if areas have been merged across gaps. */
+    std::vector<std::pair<uint64_t, size_t>> _coveredRanges;
+
     std::vector<boost::shared_ptr<TransferElement>> getHardwareAccessingElements() override {
       return {boost::enable_shared_from_this<TransferElement>::shared_from_this()};
     }
@@ -197,6 +272,9 @@ namespace ChimeraTK {
     friend class NumericAddressedBackendRegisterAccessor;
 
     friend class NumericAddressedBackendASCIIAccessor;
+
+    template<typename UserType>
+    friend class NumericAddressedBackendMuxedRegisterAccessor;
   };
 
 } // namespace ChimeraTK
@@ -6,7 +6,10 @@
 #include "BackendRegisterInfoBase.h"
 
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 namespace ChimeraTK {
 
@@ -165,6 +168,14 @@ namespace ChimeraTK {
 
     void addDataConsistencyRealm(const RegisterPath& registerPath, const std::string& realmName);
 
+    /**
+     * Check whether the given path is one of the read-only statistics registers of an async::Domain, which exist for
+     * each primary canonical interrupt, e.g. "/!3/INTERRUPT_COUNT" (see async::statistics). If so, the interrupt
+     * number and the name of the statistics register are returned.
+     */
+    [[nodiscard]] std::optional<std::pair<size_t, std::string>> getAsyncDomainStatisticsRegister(
+        const RegisterPath& registerPathName) const;
+
    protected:
     void fillFromThis(NumericAddressedRegisterCatalogue* target) const;
 
@@ -183,7 +194,7 @@ namespace ChimeraTK {
      *  For the canonical interrupt `!3:5:9` there are is an interrupt `!3:5` and the
      *  primary interrupt `!3`.
      */
-    std::map<RegisterPath, std::vector<size_t>> _canonicalInterrupts;
+    std::unordered_map<RegisterPath, std::vector<size_t>> _canonicalInterrupts;
 
     /**
      * Map of data consistency key register paths to realm names
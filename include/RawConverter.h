@@ -4,7 +4,9 @@
 
 #include "NumericAddressedRegisterCatalogue.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <span>
 #include <tuple>
 
 namespace ChimeraTK::RawConverter {
@@ -45,6 +47,22 @@ namespace ChimeraTK::RawConverter {
 
     RawType toRaw(UserType cookedValue);
 
+    /**
+     * Convert an array of raw values into cooked values. Both spans must have the same size.
+     *
+     * This is faster than calling toCooked() for each element, as the conversion parameters are held in a local copy of
+     * the converter which cannot alias with the target buffer. Together with the branch-free conversion code, this
+     * allows the compiler to vectorise the loop for the common cases (e.g. 16/32 bit fixed point to float/double, sign
+     * extension of arbitrary bit widths and IEEE754).
+     */
+    void toCooked(std::span<const RawType> rawValues, std::span<UserType> cookedValues) const;
+
+    /**
+     * Convert an array of cooked values into raw values. Both spans must have the same size. See toCooked() for
+     * arrays.
+     */
+    void toRaw(std::span<const UserType> cookedValues, std::span<RawType> rawValues) const;
+
     using raw_type = RawType;
 
    private:
@@ -365,17 +383,15 @@ namespace ChimeraTK::RawConverter {
     // returns the raw value "promoted" to the full RawType
     template<typename PromotedRawType, typename RawType, SignificantBitsCase significantBitsCase>
     constexpr PromotedRawType interpretArbitraryBitInteger(
-        RawType signBitMask, RawType usedBitMask, RawType unusedBitMask, RawType rawValue) {
+        RawType signBitMask, RawType usedBitMask, [[maybe_unused]] RawType unusedBitMask, RawType rawValue) {
       static_assert(std::is_integral_v<RawType>);
       static_assert(!std::is_signed_v<RawType>);
 
       if constexpr(significantBitsCase == SignificantBitsCase::generic) {
         if constexpr(std::is_signed_v<PromotedRawType>) {
-          if(!(rawValue & signBitMask)) { // sign bit not set: force unused bits to zero
-            return PromotedRawType(rawValue & usedBitMask);
-          }
-          // sign bit set: force unused bits to one
-          return PromotedRawType(rawValue | unusedBitMask);
+          // Branch-free sign extension, so loops over this function can be vectorised: Flipping the sign bit and
+          // subtracting it again (with unsigned wrap-around) sets all unused bits to the value of the sign bit.
+          return PromotedRawType(RawType(RawType((rawValue & usedBitMask) ^ signBitMask) - signBitMask));
         }
         else {
           // unsigned value: force unused bits to zero
@@ -553,6 +569,32 @@ namespace ChimeraTK::RawConverter {
     return RawType(promotedRawValue) & _usedBitMask;
   }
 
+  /********************************************************************************************************************/
+
+  template<typename UserType, typename RawType, SignificantBitsCase sc, FractionalCase fc, bool isSigned>
+  void Converter<UserType, RawType, sc, fc, isSigned>::toCooked(
+      std::span<const RawType> rawValues, std::span<UserType> cookedValues) const {
+    assert(rawValues.size() == cookedValues.size());
+    // Local copy, so the compiler knows that writing to cookedValues does not change the conversion parameters.
+    auto converter = *this;
+    for(size_t i = 0; i < rawValues.size(); ++i) {
+      cookedValues[i] = converter.toCooked(rawValues[i]);
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType, typename RawType, SignificantBitsCase sc, FractionalCase fc, bool isSigned>
+  void Converter<UserType, RawType, sc, fc, isSigned>::toRaw(
+      std::span<const UserType> cookedValues, std::span<RawType> rawValues) const {
+    assert(rawValues.size() == cookedValues.size());
+    // Local copy, see toCooked()
+    auto converter = *this;
+    for(size_t i = 0; i < cookedValues.size(); ++i) {
+      rawValues[i] = converter.toRaw(cookedValues[i]);
+    }
+  }
+
   /********************************************************************************************************************/
   /********************************************************************************************************************/
 
@@ -650,6 +692,10 @@ namespace ChimeraTK::RawConverter {
     UserType toCooked(RawType rawValue);
 
     RawType toRaw(UserType cookedValue);
+
+    void toCooked(std::span<const RawType> rawValues, std::span<UserType> cookedValues) const;
+
+    void toRaw(std::span<const UserType> cookedValues, std::span<RawType> rawValues) const;
   };
 
   /********************************************************************************************************************/
@@ -671,4 +717,24 @@ namespace ChimeraTK::RawConverter {
 
   /********************************************************************************************************************/
 
+  template<typename UserType, typename RawType>
+    requires(std::is_same_v<UserType, ChimeraTK::Void> || std::is_same_v<RawType, ChimeraTK::Void>)
+  void Converter<UserType, RawType, SignificantBitsCase::generic, FractionalCase::integer, false>::toCooked(
+      [[maybe_unused]] std::span<const RawType> rawValues, std::span<UserType> cookedValues) const {
+    assert(rawValues.size() == cookedValues.size());
+    std::fill(cookedValues.begin(), cookedValues.end(), UserType{});
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType, typename RawType>
+    requires(std::is_same_v<UserType, ChimeraTK::Void> || std::is_same_v<RawType, ChimeraTK::Void>)
+  void Converter<UserType, RawType, SignificantBitsCase::generic, FractionalCase::integer, false>::toRaw(
+      [[maybe_unused]] std::span<const UserType> cookedValues, std::span<RawType> rawValues) const {
+    assert(rawValues.size() == cookedValues.size());
+    std::fill(rawValues.begin(), rawValues.end(), userTypeToNumeric<RawType>(ChimeraTK::Void()));
+  }
+
+  /********************************************************************************************************************/
+
 } // namespace ChimeraTK::RawConverter
@@ -4,11 +4,17 @@
 
 #include "TransferElement.h"
 #include "TransferElementAbstractor.h"
+#include "TransferGroup.h"
 
 #include <ChimeraTK/cppext/future_queue.hpp>
 
+#include <algorithm>
+#include <deque>
 #include <functional>
 #include <initializer_list>
+#include <limits>
+#include <memory>
+#include <vector>
 
 namespace ChimeraTK {
 
@@ -181,8 +187,16 @@ namespace ChimeraTK {
      * This function will call readAsync() on all elements with AccessMode::wait_for_new_data in the group. There must
      * be at least one transfer element with AccessMode::wait_for_new_data in the group, otherwise an exception is
      * thrown.
+     *
+     * If mergePolledTransfers is true, the poll-type elements are put into an internal TransferGroup, so
+     * processPolled() can merge their transfers (e.g. into a single transfer for neighbouring registers of a
+     * NumericAddressedBackend). Elements which are already part of a TransferGroup are excluded and read individually.
+     * Since the grouped elements are then part of a TransferGroup, calling read functions on them directly will throw
+     * a ChimeraTK::logic_error. As for any TransferGroup, this membership is permanent: it is not released when the
+     * ReadAnyGroup is destroyed, so the elements (and all copies of their abstractors) can only be read through
+     * processPolled() for their entire lifetime. This is hence disabled by default.
      */
-    void finalise();
+    void finalise(bool mergePolledTransfers = false);
 
     /**
      * Wait until one of the elements in this group has received an update. The function will return the
@@ -210,6 +224,20 @@ namespace ChimeraTK {
      */
     TransferElementID readAnyNonBlocking();
 
+    /**
+     * Wait until at least one of the elements in this group has received an update, then process all updates which are
+     * already available, up to the given maximum number. The poll-type elements are updated only once after all
+     * updates have been processed, instead of once per update like in readAny(). The IDs of the updated elements are
+     * returned in the order in which the updates have been received. If an element has received multiple updates, its
+     * ID is contained multiple times and the user buffer contains the latest value.
+     *
+     * If an exception is thrown while processing an update, the updates processed before are visible in the user
+     * buffers, but the poll-type elements are not updated.
+     *
+     * Before calling this function, finalise() must have been called, otherwise the behaviour is undefined.
+     */
+    std::vector<TransferElementID> readAnyBatch(size_t maxUpdates = std::numeric_limits<size_t>::max());
+
     /**
      * Wait until the given TransferElement has received an update and store it to its user buffer. All updates of other
      * elements which are received before the update of the given element will be processed and are thus visible in the
@@ -269,6 +297,31 @@ namespace ChimeraTK {
      */
     Notification waitAnyNonBlocking();
 
+    /**
+     * Wait until at least one of the elements received an update notification, then collect all notifications which
+     * are already available, up to the given maximum number. This is similar to readAnyBatch(), but the updates are not
+     * processed yet. The IDs of the elements are returned in the order in which the notifications have been received.
+     * The caller has to accept the notifications one by one in this order with acceptBatched() and call processPolled()
+     * afterwards if needed.
+     *
+     * This allows e.g. to acquire a lock once before accepting all notifications.
+     *
+     * Notifications which have not been accepted yet are kept by the ReadAnyGroup. They are returned first by the next
+     * call to waitAnyBatch(), waitAny(), readAny() etc., so no update and no exception is lost if acceptBatched()
+     * throws (e.g. when several elements of the batch have received an exception after a device fault). Hence the
+     * returned list can be longer than the given maximum, if notifications of a previous batch are still left.
+     *
+     * Before calling this function, finalise() must have been called, otherwise the behaviour is undefined.
+     */
+    std::vector<TransferElementID> waitAnyBatch(size_t maxNotifications = std::numeric_limits<size_t>::max());
+
+    /**
+     * Accept the next notification collected by waitAnyBatch() which has not been accepted yet. Behaves like
+     * Notification::accept(), incl. throwing the exceptions received by the element. Throws a ChimeraTK::logic_error if
+     * there is no such notification.
+     */
+    bool acceptBatched();
+
     /**
      * Process polled transfer elements (update them if new values are available).
      *
@@ -286,6 +339,9 @@ namespace ChimeraTK {
     /// Call preRead() on the push_elements which need it
     void handlePreRead();
 
+    /// Check if a notification is available in notification_queue without blocking. Discarded values are removed.
+    bool hasNotification();
+
     /// Flag if this group has been finalised already
     bool isFinalised{false};
 
@@ -295,11 +351,22 @@ namespace ChimeraTK {
     /// Vector of poll-type elements in this group
     std::vector<TransferElementAbstractor> poll_elements;
 
+    /// TransferGroup of the poll-type elements if mergePolledTransfers has been requested in finalise(), else nullptr
+    std::unique_ptr<TransferGroup> _pollTransferGroup;
+
+    /// Poll-type elements which are not part of _pollTransferGroup
+    std::vector<TransferElementAbstractor> _individualPollElements;
+
     /// The notification queue, will be valid only if isFinalised == true
     cppext::future_queue<size_t> notification_queue;
 
+    /// Indices into push_elements of the notifications collected by waitAnyBatch() but not accepted yet. They have
+    /// already been taken from notification_queue.
+    std::deque<size_t> _batchedNotifications;
+
     /// Index into push_elements pointing to the last operation's TransferElementAbstractor, or
-    /// std::numeric_limits<size_t>::max() in case there was not yet an operation.
+    /// std::numeric_limits<size_t>::max() in case there was not yet an operation, or
+    /// std::numeric_limits<size_t>::max() - 1 in case no preRead() is pending.
     /// This is used to call preRead() at the beginning of the next operation.
     size_t _lastOperationIndex{std::numeric_limits<size_t>::max()};
   };
@@ -462,8 +529,11 @@ namespace ChimeraTK {
     this->isFinalised = other.isFinalised;
     this->push_elements = std::move(other.push_elements);
     this->poll_elements = std::move(other.poll_elements);
+    this->_pollTransferGroup = std::move(other._pollTransferGroup);
+    this->_individualPollElements = std::move(other._individualPollElements);
     this->_lastOperationIndex = other._lastOperationIndex;
     this->notification_queue = std::move(other.notification_queue);
+    this->_batchedNotifications = std::move(other._batchedNotifications);
     for(auto& e : push_elements) {
       e.getHighLevelImplElement()->setInReadAnyGroup(this);
     }
@@ -510,7 +580,7 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  inline void ReadAnyGroup::finalise() {
+  inline void ReadAnyGroup::finalise(bool mergePolledTransfers) {
     if(isFinalised) {
       throw ChimeraTK::logic_error("ReadAnyGroup has already been finalised, calling "
                                    "finalise() is no longer allowed.");
@@ -525,6 +595,30 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("ReadAnyGroup has no element with AccessMode::wait_for_new_data.");
     }
     notification_queue = cppext::when_any(queueList.begin(), queueList.end());
+
+    // Put the poll-type elements into a TransferGroup if requested. The implementations are added (instead of the
+    // abstractors), so a possible replacement does not affect only our copy of the abstractor but also the user's.
+    std::vector<boost::shared_ptr<TransferElement>> groupable;
+    for(auto& e : poll_elements) {
+      auto impl = e.getHighLevelImplElement();
+      if(!mergePolledTransfers || impl->_isInTransferGroup) {
+        _individualPollElements.push_back(e);
+      }
+      else if(std::find(groupable.begin(), groupable.end(), impl) == groupable.end()) {
+        groupable.push_back(impl);
+      }
+    }
+    if(groupable.size() == 1) {
+      // a TransferGroup with a single element has no benefit
+      _individualPollElements.emplace_back(groupable.front());
+    }
+    else if(groupable.size() > 1) {
+      _pollTransferGroup = std::make_unique<TransferGroup>();
+      for(auto& impl : groupable) {
+        _pollTransferGroup->addAccessor(impl);
+      }
+    }
+
     isFinalised = true;
   }
 
@@ -559,6 +653,35 @@ namespace ChimeraTK {
   }
   /********************************************************************************************************************/
 
+  inline std::vector<TransferElementID> ReadAnyGroup::readAnyBatch(size_t maxUpdates) {
+    std::vector<TransferElementID> ids;
+
+    // block until the first update has been received
+    Notification notification;
+    do {
+      notification = this->waitAny();
+    } while(!notification.accept());
+    ids.push_back(notification.getId());
+
+    // Process further updates which are already available. Each notification is accepted before obtaining the next
+    // one, so no notifications are lost if accept() throws.
+    while(ids.size() < maxUpdates) {
+      notification = this->waitAnyNonBlocking();
+      if(!notification.isReady()) {
+        break;
+      }
+      if(notification.accept()) {
+        ids.push_back(notification.getId());
+      }
+    }
+
+    this->processPolled();
+
+    return ids;
+  }
+
+  /********************************************************************************************************************/
+
   inline void ReadAnyGroup::handlePreRead() {
     // preRead() and postRead() must be called in pairs. Hence we call all preReads here before waiting for transfers to
     // finish. postRead() will be called when accepting the notification. We can call preRead() repeatedly on the same
@@ -578,6 +701,7 @@ namespace ChimeraTK {
       // has been seen, in which case no postRead() is called.
       push_elements[_lastOperationIndex].getHighLevelImplElement()->preRead(TransferType::read);
     }
+    _lastOperationIndex = std::numeric_limits<size_t>::max() - 1;
   }
 
   /********************************************************************************************************************/
@@ -585,6 +709,13 @@ namespace ChimeraTK {
   inline ReadAnyGroup::Notification ReadAnyGroup::waitAny() {
     handlePreRead();
 
+    // Notifications collected by waitAnyBatch() come first
+    if(!_batchedNotifications.empty()) {
+      auto index = _batchedNotifications.front();
+      _batchedNotifications.pop_front();
+      return {index, this};
+    }
+
     // Wait for notification
     std::size_t index;
     notification_queue.pop_wait(index);
@@ -595,7 +726,7 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  inline ReadAnyGroup::Notification ReadAnyGroup::waitAnyNonBlocking() {
+  inline bool ReadAnyGroup::hasNotification() {
   restart_after_discard_value:
     // check if update is available
     if(notification_queue.empty()) {
@@ -607,7 +738,7 @@ namespace ChimeraTK {
       //   read operation. If preRead is called here when no update is available, no preRead will be called in a
       //   possible subsequend blocking readAny(), hence there would be no way to release the testable mode lock in the
       //   right place.
-      return {};
+      return false;
     }
 
     // if update is available, peek into the queue to check whether a DiscardValueException will be read
@@ -646,16 +777,62 @@ namespace ChimeraTK {
       std::terminate();
     }
 
+    return true;
+  }
+
+  /********************************************************************************************************************/
+
+  inline ReadAnyGroup::Notification ReadAnyGroup::waitAnyNonBlocking() {
+    if(_batchedNotifications.empty() && !hasNotification()) {
+      return {};
+    }
     // now that we know that an update is available, we can defer to waitAny()
     return waitAny();
   }
 
   /********************************************************************************************************************/
 
+  inline std::vector<TransferElementID> ReadAnyGroup::waitAnyBatch(size_t maxNotifications) {
+    if(_batchedNotifications.empty()) {
+      handlePreRead();
+      std::size_t index;
+      notification_queue.pop_wait(index);
+      _batchedNotifications.push_back(index);
+    }
+    while(_batchedNotifications.size() < maxNotifications && hasNotification()) {
+      std::size_t index;
+      notification_queue.pop_wait(index);
+      _batchedNotifications.push_back(index);
+    }
+
+    std::vector<TransferElementID> ids;
+    ids.reserve(_batchedNotifications.size());
+    for(auto index : _batchedNotifications) {
+      ids.push_back(push_elements[index].getId());
+    }
+    return ids;
+  }
+
+  /********************************************************************************************************************/
+
+  inline bool ReadAnyGroup::acceptBatched() {
+    if(_batchedNotifications.empty()) {
+      throw ChimeraTK::logic_error("ReadAnyGroup::acceptBatched(): No notification left to accept.");
+    }
+    // waitAny() returns the next batched notification without blocking
+    auto notification = waitAny();
+    return notification.accept();
+  }
+
+  /********************************************************************************************************************/
+
   inline void ReadAnyGroup::processPolled() {
     // update all poll-type elements in the group
-    for(auto& e : poll_elements) {
-      if(!e.getAccessModeFlags().has(AccessMode::wait_for_new_data)) e.readLatest();
+    if(_pollTransferGroup) {
+      _pollTransferGroup->read();
+    }
+    for(auto& e : _individualPollElements) {
+      e.readLatest();
     }
   }
 
@@ -8,6 +8,8 @@
 #include <boost/range/any_range.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <memory>
+
 namespace ChimeraTK {
 
   class BackendRegisterCatalogueBase;
@@ -23,11 +25,18 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  /** Catalogue of register information */
+  /**
+   * Catalogue of register information.
+   *
+   * The catalogue is immutable. Copies share the same implementation object, hence copying is cheap.
+   */
   class RegisterCatalogue {
    public:
     explicit RegisterCatalogue(std::unique_ptr<BackendRegisterCatalogueBase>&& impl);
 
+    /** Construct from a shared implementation, see BackendRegisterCatalogueBase::getSnapshot(). */
+    explicit RegisterCatalogue(std::shared_ptr<const BackendRegisterCatalogueBase> impl);
+
     RegisterCatalogue(const RegisterCatalogue& other);
     RegisterCatalogue(RegisterCatalogue&& other) noexcept;
     RegisterCatalogue& operator=(const RegisterCatalogue& other);
@@ -88,7 +97,7 @@ namespace ChimeraTK {
     [[nodiscard]] const_iterator end() const;
 
    protected:
-    std::unique_ptr<BackendRegisterCatalogueBase> _impl;
+    std::shared_ptr<const BackendRegisterCatalogueBase> _impl;
   };
 
   /********************************************************************************************************************/
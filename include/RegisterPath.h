@@ -4,6 +4,9 @@
 
 #include "Exception.h"
 
+#include <cctype>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -12,18 +15,21 @@ namespace ChimeraTK {
   /** Class to store a register path name. Elements of the path are separated by a
    * "/" character, but an alternative separation character (e.g. ".") can
    * optionally be specified as well. Different equivalent notations will be
-   *  converted into a standardised notation automatically. */
+   *  converted into a standardised notation automatically.
+   *
+   *  The path with the alternative separator replaced by "/" and its hash are computed whenever the path is modified,
+   *  so comparisons and hash lookups (e.g. in the register catalogue) do not need to create temporary strings. */
   class RegisterPath {
    public:
-    RegisterPath() : path(separator) {}
+    RegisterPath() : path(separator) { updateNormalised(); }
     // Yes, we want implicit construction. Turn off the linter.
     // NOLINTNEXTLINE(hicpp-explicit-conversions, google-explicit-constructor)
     RegisterPath(const std::string& _path) : path(std::string(separator + _path)) { removeExtraSeparators(); }
-    RegisterPath(const RegisterPath& _path) : path(_path.path), separator_alt(_path.separator_alt) {
-      removeExtraSeparators();
-    }
-    // we can use the default assignment operator but have to declare this because we have an explicit copy constructor
+    // copies are already in standardised notation, so the normalised path and the hash can be copied as well
+    RegisterPath(const RegisterPath& _path) = default;
+    RegisterPath(RegisterPath&& _path) noexcept = default;
     RegisterPath& operator=(const RegisterPath& _path) = default;
+    RegisterPath& operator=(RegisterPath&& _path) noexcept = default;
     // Yes, we want implicit construction. Turn off the linter.
     // NOLINTNEXTLINE(hicpp-explicit-conversions, google-explicit-constructor)
     RegisterPath(const char* _path) : path(std::string(separator) + _path) { removeExtraSeparators(); }
@@ -31,7 +37,7 @@ namespace ChimeraTK {
     /** type conversion operators into std::string */
     // This is an implicit conversion operator. Turn off the linter warning to make it explicit.
     // NOLINTNEXTLINE(hicpp-explicit-conversions, google-explicit-constructor)
-    operator std::string() const { return getWithOtherSeparatorReplaced(separator_alt); }
+    operator std::string() const { return getNormalised(); }
 
     /** set alternative separator. */
     void setAltSeparator(const std::string& altSeparator) {
@@ -41,8 +47,22 @@ namespace ChimeraTK {
       else {
         separator_alt = altSeparator;
       }
+      updateNormalised();
     }
 
+    /** get alternative separator. Returns an empty string if no alternative separator is set. */
+    [[nodiscard]] const std::string& getAltSeparator() const { return separator_alt; }
+
+    /** obtain path with the alternative separator replaced by "/", including the leading separator. Same as the
+     *  conversion into std::string, but without creating a copy. */
+    [[nodiscard]] const std::string& getNormalised() const { return normalised.empty() ? path : normalised; }
+
+    /** obtain hash of the canonical form of the path, in which every character other than letters, digits and "_"
+     *  counts as separator. The canonical form does not depend on the alternative separator, so RegisterPaths which
+     *  compare equal have the same hash, even if their alternative separators differ (e.g. "A.B" without and with
+     *  "." as alternative separator). */
+    [[nodiscard]] size_t getHash() const { return hash; }
+
     /** obtain path with alternative separator character instead of "/". The
      * leading separator will be omitted */
     [[nodiscard]] std::string getWithAltSeparator() const {
@@ -71,6 +91,9 @@ namespace ChimeraTK {
 
     /** < operator: comparison used for sorting e.g.\ in std::map */
     bool operator<(const RegisterPath& rightHandSide) const {
+      if(separator_alt == rightHandSide.separator_alt) {
+        return getNormalised() < rightHandSide.getNormalised();
+      }
       std::string sepalt = getCommonAltSeparator(rightHandSide);
       return getWithOtherSeparatorReplaced(sepalt) < rightHandSide.getWithOtherSeparatorReplaced(sepalt);
     }
@@ -93,6 +116,7 @@ namespace ChimeraTK {
       else {
         path = separator;
       }
+      updateNormalised();
       return *this;
     }
 
@@ -110,11 +134,15 @@ namespace ChimeraTK {
       else {
         path = separator;
       }
+      updateNormalised();
       return *this;
     }
 
     /** comparison with other RegisterPath */
     bool operator==(const RegisterPath& rightHandSide) const {
+      if(separator_alt == rightHandSide.separator_alt) {
+        return hash == rightHandSide.hash && getNormalised() == rightHandSide.getNormalised();
+      }
       std::string sepalt = getCommonAltSeparator(rightHandSide);
       return getWithOtherSeparatorReplaced(sepalt) == rightHandSide.getWithOtherSeparatorReplaced(sepalt);
     }
@@ -139,6 +167,10 @@ namespace ChimeraTK {
 
     /** check if the register path starts with the given path */
     [[nodiscard]] bool startsWith(const RegisterPath& compare) const {
+      if(separator_alt == compare.separator_alt) {
+        const auto& otherNormalised = compare.getNormalised();
+        return getNormalised().compare(0, otherNormalised.size(), otherNormalised) == 0;
+      }
       std::string sepalt = getCommonAltSeparator(compare);
       std::string pathConverted(getWithOtherSeparatorReplaced(sepalt));
       std::string otherPathConverted(compare.getWithOtherSeparatorReplaced(sepalt));
@@ -147,6 +179,13 @@ namespace ChimeraTK {
 
     /** check if the register path ends with the given path component(s) */
     [[nodiscard]] bool endsWith(const RegisterPath& compare) const {
+      if(separator_alt == compare.separator_alt) {
+        const auto& pathNormalised = getNormalised();
+        const auto& otherNormalised = compare.getNormalised();
+        if(pathNormalised.size() < otherNormalised.size()) return false;
+        return pathNormalised.compare(pathNormalised.size() - otherNormalised.size(), otherNormalised.size(),
+                   otherNormalised) == 0;
+      }
       std::string sepalt = getCommonAltSeparator(compare);
       std::string pathConverted(getWithOtherSeparatorReplaced(sepalt));
       std::string otherPathConverted(compare.getWithOtherSeparatorReplaced(sepalt));
@@ -187,9 +226,62 @@ namespace ChimeraTK {
     /** altenative separator character */
     std::string separator_alt;
 
+    /** path with the alternative separator replaced by the standard separator. Empty if identical to path, to avoid
+     *  storing the path twice in the common case. */
+    std::string normalised;
+
+    /** hash of the canonical form of the path, see getHash() */
+    size_t hash{0};
+
     /** Search for duplicate separators (e.g. "//") and remove one of them. Also
      * removes a trailing separator, if present. */
-    void removeExtraSeparators() { path = removeExtraSeparators(path); }
+    void removeExtraSeparators() {
+      path = removeExtraSeparators(path);
+      updateNormalised();
+    }
+
+    /** Update normalised and hash after path or separator_alt has been modified. */
+    void updateNormalised() {
+      if(separator_alt.length() != 0 && path.find(separator_alt) != std::string::npos) {
+        normalised = getWithOtherSeparatorReplaced(separator_alt);
+      }
+      else {
+        normalised.clear();
+      }
+      hash = getCanonicalHash(getNormalised());
+    }
+
+    /** Compute the hash of the canonical form of the given path, see getHash(). Runs of separators count as a single
+     *  separator and trailing separators are ignored, like in removeExtraSeparators(). The canonical form is hashed
+     *  character by character with FNV-1a, so no temporary string is needed. */
+    [[nodiscard]] static size_t getCanonicalHash(const std::string& string) {
+      uint64_t canonicalHash = 0xcbf29ce484222325ULL;
+      auto addCharacter = [&](char c) {
+        canonicalHash ^= static_cast<unsigned char>(c);
+        canonicalHash *= 0x100000001b3ULL;
+      };
+      // a separator is only added once the next word character follows, so runs collapse and trailing ones vanish
+      bool separatorPending = false;
+      bool isEmpty = true;
+      for(char c : string) {
+        if(std::isalnum(static_cast<unsigned char>(c)) || c == '_') {
+          if(separatorPending) {
+            addCharacter(separator[0]);
+            separatorPending = false;
+          }
+          addCharacter(c);
+          isEmpty = false;
+        }
+        else {
+          separatorPending = true;
+        }
+      }
+      if(separatorPending && isEmpty) {
+        // the canonical form of the root path is a single separator
+        addCharacter(separator[0]);
+      }
+      return static_cast<size_t>(canonicalHash);
+    }
 
     /** Search for duplicate separators (e.g. "//") and remove one of them. Also
      * removes a trailing separator, if present. The second optional argument
@@ -256,3 +348,12 @@ namespace ChimeraTK {
   std::ostream& operator<<(std::ostream& os, const RegisterPath& me);
 
 } /* namespace ChimeraTK */
+
+/**
+ * Hash function for RegisterPath, e.g. for use in std::unordered_map. Uses the canonical form of the path, see
+ * RegisterPath::getHash().
+ */
+template<>
+struct std::hash<ChimeraTK::RegisterPath> {
+  std::size_t operator()(const ChimeraTK::RegisterPath& path) const noexcept { return path.getHash(); }
+};
@@ -27,7 +27,7 @@ namespace ChimeraTK::detail {
      * @param stream input stream to process
      * @return pair of the register catalogue and the metadata catalogue
      */
-    std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> parse(std::ifstream& stream);
+    std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> parse(std::istream& stream);
 
    private:
     /** Hold parsed content of a single line */
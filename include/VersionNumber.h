@@ -3,6 +3,7 @@
 #pragma once
 
 #include <atomic>
+#include <cassert>
 #include <chrono>
 #include <cstdint>
 #include <format>
@@ -24,9 +25,9 @@ namespace ChimeraTK {
   class VersionNumber {
    public:
     /**
-     * Default constructor: Generate new unique version number with current time as time stamp
+     * Default constructor: Generate new unique version number with current time as time stamp, see now().
      */
-    VersionNumber() : _value(nextVersionNumber()), _time(std::chrono::system_clock::now()) {}
+    VersionNumber() : _value(nextVersionNumber()), _time(now()) {}
 
     /** Copy constructor */
     VersionNumber(const VersionNumber& other) = default;
@@ -45,6 +46,62 @@ namespace ChimeraTK {
      */
     explicit VersionNumber(std::nullptr_t) : _value(0) {}
 
+    /** Clocks which can be used for the time stamps of new version numbers, see setClock(). */
+    enum class Clock {
+      precise, ///< std::chrono::system_clock (default)
+      coarse   ///< CLOCK_REALTIME_COARSE: much cheaper, but only updated once per kernel tick (typically 1 to 4 ms)
+    };
+
+    /**
+     * Select the clock used for the time stamps of all version numbers created from now on by the default constructor
+     * and by Batch. This is a process-wide setting. If the coarse clock is not available on the platform, the precise
+     * clock is used.
+     */
+    static void setClock(Clock clock) { _clock.store(clock, std::memory_order_relaxed); }
+
+    /** Return the currently selected clock. */
+    [[nodiscard]] static Clock getClock() { return _clock.load(std::memory_order_relaxed); }
+
+    /** Read the clock selected with setClock(). */
+    [[nodiscard]] static std::chrono::system_clock::time_point now() {
+      if(getClock() == Clock::coarse) {
+        return coarseNow();
+      }
+      return std::chrono::system_clock::now();
+    }
+
+    /**
+     * Generator for a batch of new unique version numbers sharing the same time stamp, e.g. all version numbers needed
+     * for handling one interrupt. The numbers are reserved with a single atomic operation, so they are consecutive.
+     * Version numbers created elsewhere in the meantime are larger than all version numbers of the batch.
+     */
+    class Batch {
+     public:
+      /** Reserve n version numbers with the time stamp of the clock selected with setClock() */
+      explicit Batch(size_t n) : Batch(n, now()) {}
+
+      /** Reserve n version numbers with the given time stamp */
+      Batch(size_t n, std::chrono::system_clock::time_point timestamp)
+      : _next(_lastGeneratedVersionNumber.fetch_add(n) + 1), _end(_next + n), _time(timestamp) {}
+
+      /**
+       * Return the next version number of the batch. Must be called at most n times. Each call returns a larger
+       * version number than the previous one.
+       */
+      VersionNumber next() {
+        assert(_next < _end);
+        return VersionNumber(_next++, _time);
+      }
+
+      /** Number of version numbers not yet returned by next() */
+      [[nodiscard]] size_t remaining() const { return _end - _next; }
+
+     private:
+      uint64_t _next;
+      uint64_t _end;
+      std::chrono::system_clock::time_point _time;
+    };
+
     /** Return the time stamp associated with this version number */
     [[nodiscard]] std::chrono::time_point<std::chrono::system_clock> getTime() const { return _time; }
 
@@ -92,6 +149,15 @@ namespace ChimeraTK {
      */
     static std::atomic<uint64_t> _lastGeneratedVersionNumber;
 
+    /** Create version number with given value and time stamp, used by Batch */
+    VersionNumber(uint64_t value, std::chrono::system_clock::time_point timestamp) : _value(value), _time(timestamp) {}
+
+    /** Read CLOCK_REALTIME_COARSE, falls back to std::chrono::system_clock if not available */
+    static std::chrono::system_clock::time_point coarseNow();
+
+    /** Clock selected with setClock() */
+    static std::atomic<Clock> _clock;
+
     friend std::ostream& operator<<(std::ostream& stream, const VersionNumber& version);
 
     template<class T, class CharT>
@@ -5,7 +5,9 @@
 #include "../VersionNumber.h"
 #include "AsyncNDRegisterAccessor.h"
 
+#include <mutex>
 #include <utility>
+#include <vector>
 
 namespace ChimeraTK::async {
 
@@ -128,8 +130,20 @@ namespace ChimeraTK::async {
      */
     std::list<TransferElementID> _delayedUnsubscriptions;
 
+    /** Protects _delayedUnsubscriptions while the variables are served by the threads of a DistributionExecutor. */
+    std::mutex _delayedUnsubscriptionsMutex;
+
     /** Internal helper function to avoid code duplication. */
     void unsubscribeImpl(TransferElementID id);
+
+    /**
+     * Call fillSendBuffer() and send() on all AsyncVariables, using the DistributionExecutor of the domain if there is
+     * one. Delayed unsubscriptions are processed afterwards. Must only be called while holding the domain lock.
+     */
+    void fillAndSendAll();
+
+    /** List of the AsyncVariables for the DistributionExecutor. Only a member to avoid memory allocations. */
+    std::vector<AsyncVariable*> _distributionList;
   };
 
   template<typename SourceType>
@@ -279,17 +293,7 @@ namespace ChimeraTK::async {
     _version = version;
 
     if(prepareIntermediateBuffers()) {
-      assert(_delayedUnsubscriptions.empty());
-      for(auto& var : _asyncVariables) {
-        var.second->fillSendBuffer();
-        _isHoldingDomainLock = this;
-        var.second->send(); // function from  the AsyncVariable base class
-        _isHoldingDomainLock = nullptr;
-      }
-      for(auto id : _delayedUnsubscriptions) {
-        unsubscribeImpl(id);
-      }
-      _delayedUnsubscriptions.clear();
+      fillAndSendAll();
     }
 
     return _version;
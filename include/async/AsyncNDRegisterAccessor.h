@@ -21,8 +21,6 @@ namespace ChimeraTK::async {
    */
   template<typename UserType>
   class AsyncNDRegisterAccessor : public NDRegisterAccessor<UserType> {
-    static constexpr size_t _queueSize{3};
-
    public:
     /** In addition to the arguments of the NDRegisterAccessor constructor, you need
      *  an AsyncAccessorManager where you can unsubscribe. As the AsyncAccessorManager is
@@ -42,9 +40,17 @@ namespace ChimeraTK::async {
 
     /** You can only send destructively. If you want to keep a copy you have to make one yourself.
      *  This is more efficient that having one extra buffer within each AsyncNDRegisterAccessor.
+     *  If the queue is full, the QueueOverflowPolicy of the Domain at the time of the subscription is applied.
+     *  The data buffer always has the same shape after the call, so it can be re-filled without allocating memory.
      */
     void sendDestructively(typename NDRegisterAccessor<UserType>::Buffer& data);
 
+    /** Number of values sent while the queue was full. */
+    [[nodiscard]] uint64_t getOverflowCount() const { return _overflowCount; }
+
+    /** Length of the data transport queue, determined from the QueuePolicy of the Domain. */
+    [[nodiscard]] size_t getQueueLength() const { return _queueLength; }
+
     ////////////////////////////////////////////////////
     // implementation of inherited, virtual functions //
     ////////////////////////////////////////////////////
@@ -104,7 +110,18 @@ namespace ChimeraTK::async {
     using NDRegisterAccessor<UserType>::buffer_2D;
     Buffer _receiveBuffer;
 
-    cppext::future_queue<Buffer, cppext::SWAP_DATA> _dataTransportQueue{_queueSize};
+    // Taken from the QueuePolicy of the Domain in the constructor. Must be declared before the queue.
+    size_t _queueLength;
+    QueueOverflowPolicy _overflowPolicy;
+    std::atomic<uint64_t> _overflowCount{0};
+
+    cppext::future_queue<Buffer, cppext::SWAP_DATA> _dataTransportQueue{_queueLength};
+
+    /** Push data to the queue according to the _overflowPolicy. */
+    void pushToQueue(Buffer& data);
+
+    /** Compute the queue length from the QueuePolicy of the domain and the size of one value. */
+    static size_t computeQueueLength(const QueuePolicy& policy, size_t nChannels, size_t nElements);
   };
 
   /********************************************************************************************************************/
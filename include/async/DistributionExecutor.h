@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ChimeraTK::async {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Small pool of worker threads, used by the async::Domain to fill the send buffers of the subscribed variables and
+   * push them into the accessor queues in parallel.
+   *
+   * The executor works fork-join style: run() distributes the tasks over the worker threads and the calling thread, and
+   * only returns when all tasks are complete. Hence the distribution still happens entirely under the domain lock,
+   * and all guarantees of the distribution tree (e.g. that data for each accessor arrives with increasing version
+   * numbers) are kept.
+   *
+   * One executor can be shared by several domains. Concurrent calls to run() are serialised.
+   */
+  class DistributionExecutor {
+   public:
+    /**
+     * Create the executor with the given number of worker threads. The thread calling run() takes part in the work,
+     * so nThreads = 1 already means that up to two tasks are executed in parallel.
+     */
+    explicit DistributionExecutor(size_t nThreads);
+    ~DistributionExecutor();
+
+    DistributionExecutor(const DistributionExecutor&) = delete;
+    DistributionExecutor& operator=(const DistributionExecutor&) = delete;
+
+    /**
+     * Execute task(i) for all i in [0, nTasks) and return after all of them have finished. If tasks throw, the first
+     * exception is re-thrown after all tasks have finished.
+     *
+     * Tasks must not call run() on the same executor.
+     */
+    void run(size_t nTasks, const std::function<void(size_t)>& task);
+
+    /** Number of worker threads (not counting the thread calling run()). */
+    [[nodiscard]] size_t getNumberOfThreads() const { return _threads.size(); }
+
+   private:
+    void workerLoop();
+    void processTasks(const std::function<void(size_t)>* task, size_t nTasks);
+
+    std::vector<std::thread> _threads;
+
+    // serialises calls to run()
+    std::mutex _runMutex;
+
+    // protects all variables below, except the atomic _nextTask
+    std::mutex _mutex;
+    std::condition_variable _workAvailable;
+    std::condition_variable _workDone;
+    const std::function<void(size_t)>* _task{nullptr};
+    size_t _nTasks{0};
+    std::atomic<size_t> _nextTask{0};
+    size_t _nBusyWorkers{0};
+    uint64_t _generation{0};
+    bool _shutdown{false};
+    std::exception_ptr _firstException;
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::async
@@ -2,13 +2,72 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #pragma once
 
+#include "../TransferElementID.h"
+#include "DistributionExecutor.h"
+
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <string>
 
 namespace ChimeraTK::async {
 
+  /**
+   * Names of the read-only registers with the statistics of a Domain. Backends expose them next to the canonical
+   * interrupt path of the domain, e.g. "/!3/INTERRUPT_COUNT".
+   */
+  namespace statistics {
+    /// Number of interrupts received by the domain, including missed ones
+    constexpr auto INTERRUPT_COUNT = "INTERRUPT_COUNT";
+    /// Number of interrupts which have not been distributed separately, because they have been coalesced by the
+    /// driver or the hardware
+    constexpr auto MISSED_INTERRUPT_COUNT = "MISSED_INTERRUPT_COUNT";
+    /// Duration of the last distribution in nanoseconds, incl. waiting for the domain lock and polling the data
+    constexpr auto DISTRIBUTION_LATENCY_NS = "DISTRIBUTION_LATENCY_NS";
+    /// Number of values which found the queue of a subscribed accessor full, summed over all accessors of the domain.
+    /// Depending on the QueueOverflowPolicy, the value has overwritten the newest value in the queue or was dropped.
+    constexpr auto QUEUE_OVERFLOW_COUNT = "QUEUE_OVERFLOW_COUNT";
+    /// Number of channel vectors which had to be resized when reading an accessor, because the application has
+    /// replaced or resized them. The vectors are repaired in the application thread before they are handed back to the
+    /// distribution. This is not a count of memory allocations, resizing a vector may or may not allocate.
+    constexpr auto BUFFER_RESIZE_COUNT = "BUFFER_RESIZE_COUNT";
+  } // namespace statistics
+
+  /********************************************************************************************************************/
+
+  /** Behaviour of the data transport queue of an AsyncNDRegisterAccessor when a value is sent to a full queue */
+  enum class QueueOverflowPolicy {
+    overwriteNewest, ///< Replace the newest value in the queue with the new one (default)
+    dropNewest,      ///< Discard the new value and keep the queue content
+    /// Before distributing, wait until the consumer has read a value. This stalls the distribution of the entire
+    /// domain! The wait is aborted if the domain is deactivated or receives an exception, see
+    /// Domain::waitForQueueSpace(). If the queue is full nevertheless (e.g. when distributing the initial value), the
+    /// newest value is overwritten.
+    /// Attention: A consumer must not trigger the distribution from its own thread (e.g. by writing to a
+    /// DUMMY_INTERRUPT register of a dummy backend) while its queue is full. This deadlocks, since the consumer would
+    /// wait for itself to read a value.
+    blockProducer
+  };
+
+  /** Configuration of the data transport queues of the AsyncNDRegisterAccessors, see Domain::setQueuePolicy() */
+  struct QueuePolicy {
+    /// Maximum number of values in the queue of each accessor
+    size_t length{3};
+    /// If not zero, limit the length of each queue such that it holds at most this number of bytes (but at least one
+    /// value). This allows long queues for scalars while limiting the memory used by large arrays.
+    size_t maxBytes{0};
+    QueueOverflowPolicy overflowPolicy{QueueOverflowPolicy::overwriteNewest};
+  };
+
+  /********************************************************************************************************************/
+
   /**
    * The Domain is the thread-safe entry point for each distribution tree.
    * Distributing data to accessors, sending exceptions and subscription of new accessors will all happen from
@@ -30,10 +89,104 @@ namespace ChimeraTK::async {
 
     std::lock_guard<std::mutex> getDomainLock() { return std::lock_guard<std::mutex>{_mutex}; }
 
+    /**
+     * Set the executor used to fill the send buffers of the subscribed variables and push them into the accessor
+     * queues. The data is still read from the device in the thread calling distribute(). If nullptr (the default), the
+     * whole distribution happens in the thread calling distribute().
+     */
+    void setDistributionExecutor(std::shared_ptr<DistributionExecutor> executor) {
+      std::lock_guard<std::mutex> l(_mutex);
+      _distributionExecutor = std::move(executor);
+    }
+
+    /**
+     * Coalescing policy: Limit the rate of distributions by enforcing a minimum interval between the start of two
+     * distributions. If distribute() is called earlier, it waits until the interval has passed. Interrupts arriving in
+     * the meantime are coalesced by the driver and should be reported through reportMissedInterrupts(), so the last
+     * state is always distributed. Zero (the default) disables the limit.
+     */
+    void setMinimumDistributionInterval(std::chrono::nanoseconds interval) {
+      _minimumDistributionIntervalNs = interval.count();
+    }
+
+    /**
+     * Set the queue configuration used for accessors subscribed from now on. Existing accessors keep their queues.
+     */
+    void setQueuePolicy(const QueuePolicy& policy) {
+      std::lock_guard<std::mutex> l(_mutex);
+      _queuePolicy = policy;
+    }
+
+    /**
+     * Backends call this if the driver or the hardware reports that interrupts have been coalesced, i.e. if more than
+     * one interrupt has occurred since the last distribution. Only the additional interrupts must be reported.
+     */
+    void reportMissedInterrupts(uint64_t nMissed) {
+      _interruptCount += nMissed;
+      _missedInterruptCount += nMissed;
+    }
+
+    /** Statistics of the domain, see the according register names in the statistics namespace. */
+    [[nodiscard]] uint64_t getInterruptCount() const { return _interruptCount; }
+    [[nodiscard]] uint64_t getMissedInterruptCount() const { return _missedInterruptCount; }
+    [[nodiscard]] uint64_t getDistributionLatencyNs() const { return _distributionLatencyNs; }
+    [[nodiscard]] uint64_t getQueueOverflowCount() const { return _queueOverflowCount; }
+    [[nodiscard]] uint64_t getBufferResizeCount() const { return _bufferResizeCount; }
+
+    /** Get one of the statistics by its register name. Throws a logic_error for unknown names. */
+    [[nodiscard]] uint64_t getStatistics(const std::string& name) const;
+
    protected:
     // This mutex is protecting all members and all functions in Domain and DomainImpl
     std::mutex _mutex;
     bool _isActive{false};
+    std::shared_ptr<DistributionExecutor> _distributionExecutor;
+    QueuePolicy _queuePolicy;
+
+    // The statistics and the coalescing policy are atomic, so they can be read and updated without holding the mutex.
+    std::atomic<uint64_t> _interruptCount{0};
+    std::atomic<uint64_t> _missedInterruptCount{0};
+    std::atomic<uint64_t> _distributionLatencyNs{0};
+    std::atomic<uint64_t> _queueOverflowCount{0};
+    std::atomic<uint64_t> _bufferResizeCount{0};
+    std::atomic<int64_t> _minimumDistributionIntervalNs{0};
+    std::atomic<int64_t> _lastDistributionStartNs{0};
+
+    /**
+     * Called by DomainImpl::distribute() before acquiring the mutex. Counts the interrupt and waits if required by the
+     * minimum distribution interval. Returns the start time of the distribution for distributionDone().
+     */
+    std::chrono::steady_clock::time_point beginDistribution();
+
+    /** Record the latency of a distribution started with beginDistribution(). */
+    void distributionDone(std::chrono::steady_clock::time_point start);
+
+    /**
+     * Called by DomainImpl::distribute() before acquiring the mutex for the distribution. Waits until the queues of all
+     * accessors with QueueOverflowPolicy::blockProducer have space for a new value. The mutex is only held while
+     * checking the queues, so subscriptions, exceptions and the deactivation can proceed while waiting. Returns without
+     * waiting further as soon as the domain is not active. The queues are checked again whenever notifyQueueSpace() is
+     * called.
+     */
+    void waitForQueueSpace();
+
+    /**
+     * Wake up waitForQueueSpace(), called when a value has been read from a queue of an accessor with
+     * QueueOverflowPolicy::blockProducer, when such an accessor is unsubscribed and when the domain is deactivated.
+     * Can be called with or without holding the mutex.
+     */
+    void notifyQueueSpace();
+
+    /// Condition variable for waitForQueueSpace(). It uses its own mutex, so consumers do not need the domain lock.
+    std::mutex _queueSpaceMutex;
+    std::condition_variable _queueSpaceCondition;
+    /// Incremented by notifyQueueSpace(), protected by _queueSpaceMutex. Used to detect notifications sent while
+    /// waitForQueueSpace() was checking the queues.
+    uint64_t _queueSpaceGeneration{0};
+
+    /// Checks whether the queue of an accessor with QueueOverflowPolicy::blockProducer has space for a new value, see
+    /// waitForQueueSpace(). Only called with the mutex held.
+    std::map<TransferElementID, std::function<bool()>> _blockingQueues;
 
     /**
      * Friend classes are allowed to read the _isActiveFlag without acquiring the mutex.
@@ -41,8 +194,32 @@ namespace ChimeraTK::async {
      */
     bool unsafeGetIsActive() const { return _isActive; }
 
-    // The friend functions are only allowed to call unsafeGetIsActive(). They must not touch any of the
-    // internal variables directly.
+    /** Same as unsafeGetIsActive() for the distribution executor. Returns nullptr if there is none. */
+    DistributionExecutor* unsafeGetDistributionExecutor() const { return _distributionExecutor.get(); }
+
+    /** Same as unsafeGetIsActive() for the queue policy. */
+    const QueuePolicy& unsafeGetQueuePolicy() const { return _queuePolicy; }
+
+    /** Called by the AsyncNDRegisterAccessors when a value is sent while their queue is full. */
+    void countQueueOverflow() { ++_queueOverflowCount; }
+
+    /** Called by the AsyncNDRegisterAccessors when a vector returned by the application had to be resized. */
+    void countBufferResize() { ++_bufferResizeCount; }
+
+    /** Called by the AsyncNDRegisterAccessors with QueueOverflowPolicy::blockProducer, see waitForQueueSpace(). */
+    void unsafeAddBlockingQueue(TransferElementID id, std::function<bool()> hasSpace) {
+      _blockingQueues[id] = std::move(hasSpace);
+    }
+
+    /** Called by the AsyncAccessorManager when unsubscribing an accessor. */
+    void unsafeRemoveBlockingQueue(TransferElementID id) {
+      if(_blockingQueues.erase(id) > 0) {
+        notifyQueueSpace();
+      }
+    }
+
+    // The friend functions are only allowed to call the unsafe functions, the count functions and notifyQueueSpace().
+    // They must not touch any of the internal variables directly.
     friend class AsyncAccessorManager;
     friend class TriggeredPollDistributor;
     template<typename BackendSpecificDataType>
@@ -31,6 +31,10 @@ namespace ChimeraTK::async {
      * In case distribute() is called after activate(), with a version number older than the polled initial value, the
      * data is dropped and not distributed. In this case the return value is VersionNumber{nullptr}.
      *
+     * Each call is counted as an interrupt in the domain statistics. If a minimum distribution interval is set (see
+     * Domain::setMinimumDistributionInterval()), the call waits before the distribution starts. It also waits for
+     * space in the queues of accessors with QueueOverflowPolicy::blockProducer, see Domain::waitForQueueSpace().
+     *
      * @ return The version number that has been used for distribution, or VersionNumber{nullptr} if there was no
      * distribution.
      */
@@ -73,6 +77,10 @@ namespace ChimeraTK::async {
 
   template<typename BackendDataType>
   VersionNumber DomainImpl<BackendDataType>::distribute(BackendDataType data, VersionNumber version) {
+    // Wait for the coalescing policy before acquiring the lock, so subscriptions are not blocked.
+    auto distributionStart = beginDistribution();
+    waitForQueueSpace();
+
     std::lock_guard l(_mutex);
     // everything incl. potential creation of a new version number must happen under the lock
     if(version == VersionNumber(nullptr)) {
@@ -96,6 +104,7 @@ namespace ChimeraTK::async {
     }
 
     subDomain->distribute(data, version);
+    distributionDone(distributionStart);
     return version;
   }
 
@@ -139,6 +148,7 @@ namespace ChimeraTK::async {
     std::lock_guard l(_mutex);
 
     _isActive = false;
+    notifyQueueSpace();
   }
 
   /********************************************************************************************************************/
@@ -153,6 +163,7 @@ namespace ChimeraTK::async {
     }
 
     _isActive = false;
+    notifyQueueSpace();
     auto subDomain = _subDomain.lock();
     if(!subDomain) {
       return;
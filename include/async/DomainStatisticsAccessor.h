@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "../NDRegisterAccessor.h"
+
+#include <functional>
+
+namespace ChimeraTK::async {
+
+  /**
+   * Read-only scalar accessor for the statistics registers of an async::Domain (see the statistics namespace in
+   * Domain.h). The value is obtained from the given function on each read. The function is called in
+   * readTransfer(), so it must not throw.
+   */
+  template<typename UserType>
+  class DomainStatisticsAccessor : public NDRegisterAccessor<UserType> {
+   public:
+    DomainStatisticsAccessor(boost::shared_ptr<DeviceBackend> backend, std::function<uint64_t(void)> getValue,
+        const RegisterPath& registerPathName, size_t numberOfElements = 1, size_t elementsOffset = 0,
+        const AccessModeFlags& flags = {});
+
+    void doReadTransferSynchronously() override;
+
+    bool doWriteTransfer(ChimeraTK::VersionNumber) override { return false; }
+
+    void doPreRead(TransferType) override;
+
+    void doPostRead(TransferType, bool hasNewData) override;
+
+    void doPreWrite(TransferType, VersionNumber) override;
+
+    [[nodiscard]] bool isReadOnly() const override { return true; }
+    [[nodiscard]] bool isReadable() const override { return true; }
+    [[nodiscard]] bool isWriteable() const override { return false; }
+
+   protected:
+    std::vector<boost::shared_ptr<TransferElement>> getHardwareAccessingElements() override {
+      return {boost::enable_shared_from_this<TransferElement>::shared_from_this()};
+    }
+
+    std::list<boost::shared_ptr<TransferElement>> getInternalElements() override { return {}; }
+
+   private:
+    boost::shared_ptr<DeviceBackend> _backend;
+    std::function<uint64_t(void)> _getValue;
+    uint64_t _value{0};
+  };
+
+  DECLARE_TEMPLATE_FOR_CHIMERATK_USER_TYPES(DomainStatisticsAccessor);
+
+} // namespace ChimeraTK::async
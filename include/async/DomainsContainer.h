@@ -99,6 +99,22 @@ namespace ChimeraTK::async {
      */
     void forEach(const std::function<void(size_t, boost::shared_ptr<Domain>&)>& executeMe);
 
+    /**
+     * Set the DistributionExecutor for all existing and future Domains. See Domain::setDistributionExecutor().
+     */
+    void setDistributionExecutor(const std::shared_ptr<DistributionExecutor>& executor);
+
+    /**
+     * Set the minimum distribution interval for all existing and future Domains. See
+     * Domain::setMinimumDistributionInterval().
+     */
+    void setMinimumDistributionInterval(std::chrono::nanoseconds interval);
+
+    /**
+     * Set the queue policy for all existing and future Domains. See Domain::setQueuePolicy().
+     */
+    void setQueuePolicy(const QueuePolicy& policy);
+
    protected:
     std::atomic_bool _isSendingExceptions{false};
 
@@ -114,6 +130,9 @@ namespace ChimeraTK::async {
 
     std::mutex _domainsMutex;
     std::map<size_t, boost::weak_ptr<Domain>> _domains;
+    std::shared_ptr<DistributionExecutor> _distributionExecutor;
+    std::chrono::nanoseconds _minimumDistributionInterval{0};
+    QueuePolicy _queuePolicy;
   };
 
   /********************************************************************************************************************/
@@ -136,6 +155,9 @@ namespace ChimeraTK::async {
       // The domain does not exist, create it
       domainCreated = true;
       domainImpl = boost::make_shared<DomainImpl<BackendSpecificDataType>>(backend, domainId);
+      domainImpl->setDistributionExecutor(_distributionExecutor);
+      domainImpl->setMinimumDistributionInterval(_minimumDistributionInterval);
+      domainImpl->setQueuePolicy(_queuePolicy);
       // start the thread if not already running
       { // thread lock scope
         auto threadCreationLock = std::lock_guard(_threadCreationMutex);
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include "DomainImpl.h"
+
+#include <future>
+#include <memory>
+#include <string>
+
+namespace ChimeraTK::async {
+
+  /**
+   * Reader for an interrupt event file, used by backends whose driver signals interrupts through a file (e.g. the
+   * "events<N>" files of the XDMA driver).
+   *
+   * Protocol of the file: a read blocks until at least one interrupt has occurred and returns the number of interrupts
+   * since the previous read as a 32 bit unsigned integer in native byte order. The file must support poll/epoll, so
+   * device nodes and FIFOs work, but regular files do not.
+   *
+   * A thread started with startThread() waits for events and distributes each of them once to the given async domain.
+   * If an event reports more than one interrupt, the surplus is reported to the domain as missed interrupts. I/O errors
+   * and removal of the file are reported through the backend's setException(), after which the thread terminates.
+   */
+  class InterruptEventFile {
+   public:
+    /** Open the event file. Throws ChimeraTK::runtime_error if the file cannot be opened. */
+    InterruptEventFile(
+        DeviceBackend* backend, std::string path, boost::shared_ptr<DomainImpl<std::nullptr_t>> asyncDomain);
+    InterruptEventFile(const InterruptEventFile&) = delete;
+    InterruptEventFile& operator=(const InterruptEventFile&) = delete;
+
+    /** Stops the thread and closes the file */
+    ~InterruptEventFile();
+
+    /**
+     * Start the thread waiting for events. The promise is fulfilled as soon as the thread waits for events, or
+     * immediately if the thread is already running.
+     */
+    void startThread(std::promise<void> subscriptionDonePromise);
+
+    [[nodiscard]] const std::string& getPath() const { return _path; }
+
+    /// Number of interrupts which have been reported by the driver but could not be distributed separately, because
+    /// they occurred before the previous interrupt has been read.
+    [[nodiscard]] uint64_t getMissedInterruptCount() const { return _asyncDomain->getMissedInterruptCount(); }
+
+   private:
+    class EventThread;
+
+    /// Check whether the file is still present (it might have been removed e.g. by hot-unplugging the device)
+    [[nodiscard]] bool goodState() const;
+
+    DeviceBackend* _backend; // needed for reporting exceptions
+    std::string _path;
+    int _fd;
+    boost::shared_ptr<DomainImpl<std::nullptr_t>> _asyncDomain;
+    std::unique_ptr<EventThread> _eventThread;
+  };
+
+} // namespace ChimeraTK::async
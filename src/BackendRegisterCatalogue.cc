@@ -7,6 +7,40 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  BackendRegisterCatalogueBase::BackendRegisterCatalogueBase(BackendRegisterCatalogueBase&& other) noexcept {
+    std::lock_guard<std::mutex> lock(other._snapshotMutex);
+    _snapshot = std::move(other._snapshot);
+  }
+
+  /********************************************************************************************************************/
+
+  BackendRegisterCatalogueBase& BackendRegisterCatalogueBase::operator=(BackendRegisterCatalogueBase&& other) noexcept {
+    if(this != &other) {
+      std::scoped_lock lock(_snapshotMutex, other._snapshotMutex);
+      _snapshot = std::move(other._snapshot);
+    }
+    return *this;
+  }
+
+  /********************************************************************************************************************/
+
+  std::shared_ptr<const BackendRegisterCatalogueBase> BackendRegisterCatalogueBase::getSnapshot() const {
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+    if(!_snapshot) {
+      _snapshot = clone();
+    }
+    return _snapshot;
+  }
+
+  /********************************************************************************************************************/
+
+  void BackendRegisterCatalogueBase::markModified() {
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+    _snapshot.reset();
+  }
+
+  /********************************************************************************************************************/
+
   [[nodiscard]] std::shared_ptr<async::DataConsistencyRealm> BackendRegisterCatalogueBase::getDataConsistencyRealm(
       const std::vector<size_t>& /* qualifiedAsyncDomainId */) const {
     return nullptr;
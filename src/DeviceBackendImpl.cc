@@ -67,4 +67,111 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  void DeviceBackendImpl::setAsyncDistributionThreads(size_t nThreads) {
+    _asyncDomainsContainer.setDistributionExecutor(
+        nThreads > 0 ? std::make_shared<async::DistributionExecutor>(nThreads) : nullptr);
+  }
+
+  /********************************************************************************************************************/
+
+  void DeviceBackendImpl::setMaximumAsyncDistributionRate(double distributionsPerSecond) {
+    std::chrono::nanoseconds interval{0};
+    if(distributionsPerSecond > 0) {
+      interval = std::chrono::nanoseconds(static_cast<int64_t>(1e9 / distributionsPerSecond));
+    }
+    _asyncDomainsContainer.setMinimumDistributionInterval(interval);
+  }
+
+  /********************************************************************************************************************/
+
+  void DeviceBackendImpl::setAsyncQueuePolicy(const async::QueuePolicy& policy) {
+    _asyncDomainsContainer.setQueuePolicy(policy);
+  }
+
+  /********************************************************************************************************************/
+
+  void DeviceBackendImpl::setAsyncDistributionPolicy(const std::map<std::string, std::string>& parameters) {
+    auto it = parameters.find("distributionThreads");
+    if(it != parameters.end() && !it->second.empty()) {
+      int nThreads{-1};
+      try {
+        nThreads = std::stoi(it->second, nullptr, 0);
+      }
+      catch(std::exception&) {
+        // error is reported below
+      }
+      if(nThreads < 0) {
+        throw ChimeraTK::logic_error("Invalid value for parameter 'distributionThreads': '" + it->second +
+            "' is not a valid number of threads.");
+      }
+      setAsyncDistributionThreads(static_cast<size_t>(nThreads));
+    }
+
+    it = parameters.find("maxDistributionRate");
+    if(it != parameters.end() && !it->second.empty()) {
+      double rate{-1};
+      try {
+        rate = std::stod(it->second);
+      }
+      catch(std::exception&) {
+        // error is reported below
+      }
+      if(!(rate >= 0)) {
+        throw ChimeraTK::logic_error(
+            "Invalid value for parameter 'maxDistributionRate': '" + it->second + "' is not a valid rate.");
+      }
+      setMaximumAsyncDistributionRate(rate);
+    }
+
+    async::QueuePolicy queuePolicy;
+    bool hasQueuePolicy{false};
+    for(const auto* name : {"asyncQueueLength", "asyncQueueMaxBytes"}) {
+      it = parameters.find(name);
+      if(it == parameters.end() || it->second.empty()) {
+        continue;
+      }
+      size_t value{0};
+      try {
+        value = std::stoul(it->second, nullptr, 0);
+      }
+      catch(std::exception&) {
+        throw ChimeraTK::logic_error(
+            std::string("Invalid value for parameter '") + name + "': '" + it->second + "' is not a valid number.");
+      }
+      if(std::string(name) == "asyncQueueLength") {
+        if(value == 0) {
+          throw ChimeraTK::logic_error("Invalid value for parameter 'asyncQueueLength': must be at least 1.");
+        }
+        queuePolicy.length = value;
+      }
+      else {
+        queuePolicy.maxBytes = value;
+      }
+      hasQueuePolicy = true;
+    }
+
+    it = parameters.find("asyncQueueOverflow");
+    if(it != parameters.end() && !it->second.empty()) {
+      if(it->second == "overwriteNewest") {
+        queuePolicy.overflowPolicy = async::QueueOverflowPolicy::overwriteNewest;
+      }
+      else if(it->second == "dropNewest") {
+        queuePolicy.overflowPolicy = async::QueueOverflowPolicy::dropNewest;
+      }
+      else if(it->second == "blockProducer") {
+        queuePolicy.overflowPolicy = async::QueueOverflowPolicy::blockProducer;
+      }
+      else {
+        throw ChimeraTK::logic_error("Invalid value for parameter 'asyncQueueOverflow': '" + it->second +
+            "'. Must be one of 'overwriteNewest', 'dropNewest' and 'blockProducer'.");
+      }
+      hasQueuePolicy = true;
+    }
+    if(hasQueuePolicy) {
+      setAsyncQueuePolicy(queuePolicy);
+    }
+  }
+
+  /********************************************************************************************************************/
+
 } // namespace ChimeraTK
@@ -20,7 +20,7 @@ namespace ChimeraTK::detail {
   struct JsonAddressSpaceEntry;
 
   struct JsonMapFileParser::Imp {
-    std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> parse(std::ifstream& stream);
+    std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> parse(std::istream& stream);
 
     std::string fileName;
     NumericAddressedRegisterCatalogue catalogue;
@@ -35,7 +35,7 @@ namespace ChimeraTK::detail {
 
   /********************************************************************************************************************/
 
-  std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> JsonMapFileParser::parse(std::ifstream& stream) {
+  std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> JsonMapFileParser::parse(std::istream& stream) {
     return _theImp->parse(stream);
   }
 
@@ -333,7 +333,7 @@ namespace ChimeraTK::detail {
   /********************************************************************************************************************/
   /********************************************************************************************************************/
 
-  std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> JsonMapFileParser::Imp::parse(std::ifstream& stream) {
+  std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> JsonMapFileParser::Imp::parse(std::istream& stream) {
     // read and parse JSON data
     try {
       auto data = json::parse(stream);
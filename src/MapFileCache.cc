@@ -0,0 +1,377 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "MapFileCache.h"
+
+#include "VersionInfo.h"
+
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+namespace ChimeraTK::detail {
+
+  namespace {
+
+    /******************************************************************************************************************/
+
+    constexpr char MAGIC[8] = {'C', 'T', 'K', 'M', 'A', 'P', 'C', '\0'};
+
+    // Increase whenever the binary format or the content of the catalogues changes.
+    constexpr uint32_t FORMAT_VERSION = 2;
+
+    // Written in native byte order to detect cache files from machines with different byte order.
+    constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    /******************************************************************************************************************/
+
+    // Version of this library. It is part of the cache key and the file header, so a changed parser never uses cache
+    // files written by another version, even if FORMAT_VERSION has not been increased.
+    std::string getLibraryVersion() {
+      return std::string(VersionInfo::soVersion) + "." + std::to_string(VersionInfo::applicationPatch);
+    }
+
+    /******************************************************************************************************************/
+
+    class Writer {
+     public:
+      template<typename T>
+      void put(T value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+      }
+
+      void put(const std::string& value) {
+        put<uint32_t>(value.size());
+        data.append(value);
+      }
+
+      std::string data;
+    };
+
+    /******************************************************************************************************************/
+
+    /**
+     * Reader with bounds and value checks, throws std::out_of_range if reading beyond the end of the data or if a
+     * value is not valid.
+     */
+    class Reader {
+     public:
+      explicit Reader(std::string_view data_) : data(data_) {}
+
+      template<typename T>
+      T get() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        std::memcpy(&value, take(sizeof(T)).data(), sizeof(T));
+        return value;
+      }
+
+      std::string getString() { return std::string(take(get<uint32_t>())); }
+
+      bool getBool() {
+        auto value = get<uint8_t>();
+        if(value > 1) {
+          throw std::out_of_range("Map file cache contains invalid boolean");
+        }
+        return value;
+      }
+
+      /** Read an enum stored as uint8_t, with lastValue being the last valid value of the contiguous enum */
+      template<typename ENUM>
+      ENUM getEnum(ENUM lastValue) {
+        auto value = get<uint8_t>();
+        if(value > static_cast<uint8_t>(lastValue)) {
+          throw std::out_of_range("Map file cache contains invalid enum value");
+        }
+        return static_cast<ENUM>(value);
+      }
+
+      std::string_view take(size_t n) {
+        if(n > data.size() - pos) {
+          throw std::out_of_range("Map file cache truncated");
+        }
+        auto ret = data.substr(pos, n);
+        pos += n;
+        return ret;
+      }
+
+      /** Check that at least n more bytes are available, without consuming them */
+      [[nodiscard]] std::string_view peek(size_t n) const {
+        if(n > data.size() - pos) {
+          throw std::out_of_range("Map file cache truncated");
+        }
+        return data.substr(pos, n);
+      }
+
+      [[nodiscard]] bool atEnd() const { return pos == data.size(); }
+
+     private:
+      std::string_view data;
+      size_t pos{0};
+    };
+
+    /******************************************************************************************************************/
+
+    // Size of one serialised channel, see putRegister()
+    constexpr size_t channelSizeInBytes = 4 + 1 + 4 + 4 + 1 + 4;
+
+    void putRegister(Writer& w, const NumericAddressedRegisterInfo& info) {
+      w.put(std::string(info.pathName));
+      w.put<uint64_t>(info.bar);
+      w.put<uint64_t>(info.address);
+      w.put<uint32_t>(info.nElements);
+      w.put<uint32_t>(info.elementPitchBits);
+      w.put<uint8_t>(static_cast<uint8_t>(info.registerAccess));
+      w.put<uint8_t>(info.hidden);
+
+      w.put<uint32_t>(info.interruptId.size());
+      for(auto id : info.interruptId) {
+        w.put<uint64_t>(id);
+      }
+
+      w.put<uint8_t>(info.doubleBuffer.has_value());
+      if(info.doubleBuffer) {
+        w.put<uint64_t>(info.doubleBuffer->address);
+        w.put(std::string(info.doubleBuffer->enableRegisterPath));
+        w.put(std::string(info.doubleBuffer->inactiveBufferRegisterPath));
+        w.put<uint32_t>(info.doubleBuffer->index);
+      }
+
+      w.put<uint32_t>(info.channels.size());
+      for(const auto& channel : info.channels) {
+        w.put<uint32_t>(channel.bitOffset);
+        w.put<uint8_t>(static_cast<uint8_t>(channel.dataType));
+        w.put<uint32_t>(channel.width);
+        w.put<int32_t>(channel.nFractionalBits);
+        w.put<uint8_t>(channel.signedFlag);
+        w.put<int32_t>(DataType::TheType(channel.rawType));
+      }
+    }
+
+    /******************************************************************************************************************/
+
+    NumericAddressedRegisterInfo getRegister(Reader& r) {
+      auto name = r.getString();
+      if(name.empty()) {
+        throw std::out_of_range("Map file cache contains register without name");
+      }
+      RegisterPath pathName(name);
+      auto bar = r.get<uint64_t>();
+      auto address = r.get<uint64_t>();
+      auto nElements = r.get<uint32_t>();
+      auto elementPitchBits = r.get<uint32_t>();
+      auto access = r.getEnum(NumericAddressedRegisterInfo::Access::INTERRUPT);
+      bool hidden = r.getBool();
+
+      // check against the remaining size before allocating, a corrupted size must not lead to huge allocations
+      auto nInterruptIds = r.get<uint32_t>();
+      std::ignore = r.peek(size_t(nInterruptIds) * sizeof(uint64_t));
+      std::vector<size_t> interruptId(nInterruptIds);
+      for(auto& id : interruptId) {
+        id = r.get<uint64_t>();
+      }
+      if(interruptId.empty() && access == NumericAddressedRegisterInfo::Access::INTERRUPT) {
+        throw std::out_of_range("Map file cache contains inconsistent interrupt information");
+      }
+
+      std::optional<NumericAddressedRegisterInfo::DoubleBufferInfo> doubleBuffer;
+      if(r.getBool()) {
+        doubleBuffer.emplace();
+        doubleBuffer->address = r.get<uint64_t>();
+        doubleBuffer->enableRegisterPath = r.getString();
+        doubleBuffer->inactiveBufferRegisterPath = r.getString();
+        doubleBuffer->index = r.get<uint32_t>();
+      }
+
+      auto nChannels = r.get<uint32_t>();
+      if(nChannels == 0) {
+        throw std::out_of_range("Map file cache contains register without channels");
+      }
+      std::ignore = r.peek(size_t(nChannels) * channelSizeInBytes);
+      std::vector<NumericAddressedRegisterInfo::ChannelInfo> channels(nChannels);
+      for(auto& channel : channels) {
+        channel.bitOffset = r.get<uint32_t>();
+        channel.dataType = r.getEnum(NumericAddressedRegisterInfo::Type::ASCII);
+        channel.width = r.get<uint32_t>();
+        channel.nFractionalBits = r.get<int32_t>();
+        channel.signedFlag = r.getBool();
+        auto rawType = r.get<int32_t>();
+        // same limits as applied by the map file parsers
+        if(channel.nFractionalBits > 1023 || channel.nFractionalBits < -1024 || rawType < DataType::none ||
+            rawType > DataType::Void) {
+          throw std::out_of_range("Map file cache contains invalid channel information");
+        }
+        channel.rawType = DataType(static_cast<DataType::TheType>(rawType));
+      }
+
+      NumericAddressedRegisterInfo info(pathName, bar, address, nElements, elementPitchBits, std::move(channels),
+          access, std::move(interruptId), std::move(doubleBuffer));
+      info.hidden = hidden;
+      return info;
+    }
+
+    /******************************************************************************************************************/
+
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  MapFileCache::MapFileCache(std::string cacheDirectory) : _cacheDirectory(std::move(cacheDirectory)) {}
+
+  /********************************************************************************************************************/
+
+  std::optional<MapFileCache::Content> MapFileCache::load(
+      const std::string& mapFileName, std::string_view mapFileContent) const {
+    auto contentHash = getCacheKey(mapFileContent);
+    std::ifstream file(getCacheFileName(mapFileName, contentHash), std::ios::binary);
+    if(!file) {
+      return std::nullopt;
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return deserialise(data, contentHash);
+  }
+
+  /********************************************************************************************************************/
+
+  void MapFileCache::store(
+      const std::string& mapFileName, std::string_view mapFileContent, const Content& content) const {
+    auto contentHash = getCacheKey(mapFileContent);
+    auto data = serialise(content, contentHash);
+
+    std::error_code ec;
+    std::filesystem::create_directories(_cacheDirectory, ec);
+
+    // write to a temporary file first and rename it afterwards, so other processes never see incomplete files
+    auto fileName = getCacheFileName(mapFileName, contentHash);
+    std::stringstream tempFileName;
+    tempFileName << fileName << ".tmp" << getpid() << "_" << std::this_thread::get_id();
+    {
+      std::ofstream file(tempFileName.str(), std::ios::binary | std::ios::trunc);
+      if(!file) {
+        return;
+      }
+      file.write(data.data(), static_cast<std::streamsize>(data.size()));
+      if(!file) {
+        file.close();
+        std::filesystem::remove(tempFileName.str(), ec);
+        return;
+      }
+    }
+    std::filesystem::rename(tempFileName.str(), fileName, ec);
+    if(ec) {
+      std::filesystem::remove(tempFileName.str(), ec);
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  std::string MapFileCache::serialise(const Content& content, uint64_t contentHash) {
+    const auto& [catalogue, metadata] = content;
+    Writer w;
+
+    w.data.append(MAGIC, sizeof(MAGIC));
+    w.put<uint32_t>(FORMAT_VERSION);
+    w.put<uint32_t>(BYTE_ORDER_MARK);
+    w.put(getLibraryVersion());
+    w.put<uint64_t>(contentHash);
+
+    w.put<uint32_t>(metadata.getNumberOfMetadata());
+    for(auto it = metadata.cbegin(); it != metadata.cend(); ++it) {
+      w.put(it->first);
+      w.put(it->second);
+    }
+
+    // Non-hidden registers first, to keep the insertion order used for iterating the catalogue
+    std::vector<const NumericAddressedRegisterInfo*> registers;
+    for(const auto& info : catalogue) {
+      registers.push_back(&info);
+    }
+    for(const auto& info : catalogue.hiddenRegisters()) {
+      registers.push_back(&dynamic_cast<const NumericAddressedRegisterInfo&>(info));
+    }
+    w.put<uint32_t>(registers.size());
+    for(const auto* info : registers) {
+      putRegister(w, *info);
+    }
+
+    return std::move(w.data);
+  }
+
+  /********************************************************************************************************************/
+
+  std::optional<MapFileCache::Content> MapFileCache::deserialise(std::string_view data, uint64_t contentHash) {
+    try {
+      Reader r(data);
+      if(r.take(sizeof(MAGIC)) != std::string_view(MAGIC, sizeof(MAGIC)) || r.get<uint32_t>() != FORMAT_VERSION ||
+          r.get<uint32_t>() != BYTE_ORDER_MARK || r.getString() != getLibraryVersion() ||
+          r.get<uint64_t>() != contentHash) {
+        return std::nullopt;
+      }
+
+      Content content;
+      auto& [catalogue, metadata] = content;
+
+      auto nMetadata = r.get<uint32_t>();
+      for(uint32_t i = 0; i < nMetadata; ++i) {
+        auto key = r.getString();
+        metadata.addMetadata(key, r.getString());
+      }
+
+      auto nRegisters = r.get<uint32_t>();
+      for(uint32_t i = 0; i < nRegisters; ++i) {
+        catalogue.addRegister(getRegister(r));
+      }
+
+      if(!r.atEnd()) {
+        return std::nullopt;
+      }
+      return content;
+    }
+    catch(std::out_of_range&) {
+      return std::nullopt;
+    }
+    catch(ChimeraTK::logic_error&) {
+      // e.g. duplicate register names in a corrupted file
+      return std::nullopt;
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  uint64_t MapFileCache::hash(std::string_view data, uint64_t basis) {
+    uint64_t h = basis;
+    for(unsigned char c : data) {
+      h ^= c;
+      h *= 0x100000001b3ULL;
+    }
+    return h;
+  }
+
+  /********************************************************************************************************************/
+
+  uint64_t MapFileCache::getCacheKey(std::string_view mapFileContent) {
+    static const uint64_t versionHash = hash(getLibraryVersion());
+    return hash(mapFileContent, versionHash);
+  }
+
+  /********************************************************************************************************************/
+
+  std::string MapFileCache::getCacheFileName(const std::string& mapFileName, uint64_t contentHash) const {
+    std::stringstream name;
+    name << std::filesystem::path(mapFileName).filename().string() << "-" << std::hex << std::setw(16)
+         << std::setfill('0') << contentHash << ".cache";
+    return (std::filesystem::path(_cacheDirectory) / name.str()).string();
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::detail
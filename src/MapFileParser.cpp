@@ -4,12 +4,32 @@
 #include "MapFileParser.h"
 
 #include "JsonMapFileParser.h"
+#include "MapFileCache.h"
 #include "TraditionalMapFileParser.h"
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <cstdlib>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+
 namespace ChimeraTK {
 
+  namespace {
+
+    std::mutex cacheDirectoryMutex;
+
+    std::string& cacheDirectory() {
+      static std::string directory = [] {
+        const char* env = std::getenv("CHIMERATK_MAP_FILE_CACHE_DIR");
+        return std::string(env ? env : "");
+      }();
+      return directory;
+    }
+
+  } // namespace
+
   /********************************************************************************************************************/
 
   std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> MapFileParser::parse(const std::string& fileName) {
@@ -20,12 +40,49 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("Cannot open file \"" + fileName + "\"");
     }
 
+    auto directory = getCacheDirectory();
+    if(directory.empty()) {
+      if(boost::ends_with(fileName, ".jmap")) {
+        detail::JsonMapFileParser parser(fileName);
+        return parser.parse(file);
+      }
+      detail::TraditionalMapFileParser parser(fileName);
+      return parser.parse(file);
+    }
+
+    // The cache is keyed by the file content, so the file has to be read completely in any case.
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    detail::MapFileCache cache(directory);
+    if(auto cached = cache.load(fileName, content)) {
+      return std::move(*cached);
+    }
+
+    std::istringstream stream(content);
+    std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> parsed;
     if(boost::ends_with(fileName, ".jmap")) {
       detail::JsonMapFileParser parser(fileName);
-      return parser.parse(file);
+      parsed = parser.parse(stream);
+    }
+    else {
+      detail::TraditionalMapFileParser parser(fileName);
+      parsed = parser.parse(stream);
     }
-    detail::TraditionalMapFileParser parser(fileName);
-    return parser.parse(file);
+    cache.store(fileName, content, parsed);
+    return parsed;
+  }
+
+  /********************************************************************************************************************/
+
+  void MapFileParser::setCacheDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(cacheDirectoryMutex);
+    cacheDirectory() = directory;
+  }
+
+  /********************************************************************************************************************/
+
+  std::string MapFileParser::getCacheDirectory() {
+    std::lock_guard<std::mutex> lock(cacheDirectoryMutex);
+    return cacheDirectory();
   }
 
   /********************************************************************************************************************/
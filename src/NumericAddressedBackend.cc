@@ -5,6 +5,7 @@
 
 #include "async/DomainImpl.h"
 #include "async/DomainsContainer.h"
+#include "async/DomainStatisticsAccessor.h"
 #include "DoubleBufferAccessor.h"
 #include "Exception.h"
 #include "MapFileParser.h"
@@ -117,9 +118,45 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  void NumericAddressedBackend::setMergePolicy(size_t maxGap, size_t maxMergedTransferSize) {
+    _maxMergeGap = maxGap;
+    _maxMergedTransferSize = maxMergedTransferSize;
+  }
+
+  /********************************************************************************************************************/
+
+  void NumericAddressedBackend::setMergePolicy(const std::map<std::string, std::string>& parameters) {
+    auto parseSize = [&](const std::string& key, size_t& target) {
+      auto it = parameters.find(key);
+      if(it == parameters.end() || it->second.empty()) {
+        return;
+      }
+      try {
+        target = std::stoull(it->second, nullptr, 0);
+      }
+      catch(std::exception&) {
+        throw ChimeraTK::logic_error("NumericAddressedBackend: Invalid value for parameter '" + key + "': '" +
+            it->second + "' is not a valid size.");
+      }
+    };
+    parseSize("maxMergeGap", _maxMergeGap);
+    parseSize("maxMergeSize", _maxMergedTransferSize);
+  }
+
+  /********************************************************************************************************************/
+
   template<typename UserType>
   boost::shared_ptr<NDRegisterAccessor<UserType>> NumericAddressedBackend::getRegisterAccessor_impl(
       const RegisterPath& registerPathName, size_t numberOfWords, size_t wordOffsetInRegister, AccessModeFlags flags) {
+    if(auto statistics = _registerMap.getAsyncDomainStatisticsRegister(registerPathName)) {
+      auto getValue = [this, interrupt = statistics->first, name = statistics->second]() -> uint64_t {
+        auto domain = _asyncDomainsContainer.getDomain(interrupt);
+        // there are no statistics before the first subscription
+        return domain ? domain->getStatistics(name) : 0;
+      };
+      return boost::make_shared<async::DomainStatisticsAccessor<UserType>>(
+          shared_from_this(), getValue, registerPathName, numberOfWords, wordOffsetInRegister, flags);
+    }
     if(flags.has(AccessMode::wait_for_new_data)) {
       // get the interrupt information from the map file
       auto registerInfo = _registerMap.getBackendRegister(registerPathName);
@@ -239,7 +276,7 @@ namespace ChimeraTK {
   /********************************************************************************************************************/
 
   RegisterCatalogue NumericAddressedBackend::getRegisterCatalogue() const {
-    return RegisterCatalogue(_registerMap.clone());
+    return RegisterCatalogue(_registerMap.getSnapshot());
   }
 
   /********************************************************************************************************************/
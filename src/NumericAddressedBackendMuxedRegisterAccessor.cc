@@ -3,10 +3,113 @@
 
 #include "NumericAddressedBackendMuxedRegisterAccessor.h"
 
+#include <array>
+#include <span>
+
 namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  namespace {
+
+    // Size of the scratch buffer holding one block of demultiplexed raw data. The raw block, the scratch buffer and
+    // the cooked target ranges together should fit into the L1 cache.
+    constexpr size_t demuxBlockBytes = 16384;
+
+    // Edge length of the square tiles used for transposing contiguous channels. A tile of fixed size is small enough to
+    // be held in vector registers, so the compiler can perform the transpose with shuffle instructions.
+    constexpr size_t tileSize = 8;
+
+    /******************************************************************************************************************/
+
+    // Demultiplex nSamples samples of nChannels equidistant channels into the channel-major scratch buffer, i.e.
+    // channel c of sample s ends up at scratch[c * nSamples + s].
+    template<typename RawType>
+    void demultiplexBlock(const std::byte* raw, size_t pitch, std::ptrdiff_t channelStride, size_t nChannels,
+        size_t nSamples, RawType* scratch) {
+      size_t sample = 0;
+
+      // Contiguous channels in multiples of the tile size (e.g. 8, 16 or 32 channels of int16 or int32): transpose
+      // tile by tile. Each row of a tile is a single contiguous load from the raw buffer.
+      if(channelStride == static_cast<std::ptrdiff_t>(sizeof(RawType)) && nChannels % tileSize == 0) {
+        for(; sample + tileSize <= nSamples; sample += tileSize) {
+          for(size_t channel = 0; channel < nChannels; channel += tileSize) {
+            std::array<std::array<RawType, tileSize>, tileSize> tile;
+            for(size_t row = 0; row < tileSize; ++row) {
+              std::memcpy(tile[row].data(), raw + (sample + row) * pitch + channel * sizeof(RawType),
+                  tileSize * sizeof(RawType));
+            }
+            for(size_t col = 0; col < tileSize; ++col) {
+              for(size_t row = 0; row < tileSize; ++row) {
+                scratch[(channel + col) * nSamples + sample + row] = tile[row][col];
+              }
+            }
+          }
+        }
+      }
+
+      // Remaining samples and arbitrary channel layouts
+      for(; sample < nSamples; ++sample) {
+        const std::byte* rawSample = raw + sample * pitch;
+        for(size_t channel = 0; channel < nChannels; ++channel) {
+          std::memcpy(&scratch[channel * nSamples + sample],
+              rawSample + static_cast<std::ptrdiff_t>(channel) * channelStride, sizeof(RawType));
+        }
+      }
+    }
+
+    /******************************************************************************************************************/
+
+    // Inverse of demultiplexBlock(): multiplex the channel-major scratch buffer into the raw buffer. Bytes in the raw
+    // buffer which do not belong to one of the channels are left untouched.
+    template<typename RawType>
+    void multiplexBlock(const RawType* scratch, size_t pitch, std::ptrdiff_t channelStride, size_t nChannels,
+        size_t nSamples, std::byte* raw) {
+      size_t sample = 0;
+
+      if(channelStride == static_cast<std::ptrdiff_t>(sizeof(RawType)) && nChannels % tileSize == 0) {
+        for(; sample + tileSize <= nSamples; sample += tileSize) {
+          for(size_t channel = 0; channel < nChannels; channel += tileSize) {
+            std::array<std::array<RawType, tileSize>, tileSize> tile;
+            for(size_t col = 0; col < tileSize; ++col) {
+              for(size_t row = 0; row < tileSize; ++row) {
+                tile[row][col] = scratch[(channel + col) * nSamples + sample + row];
+              }
+            }
+            for(size_t row = 0; row < tileSize; ++row) {
+              std::memcpy(raw + (sample + row) * pitch + channel * sizeof(RawType), tile[row].data(),
+                  tileSize * sizeof(RawType));
+            }
+          }
+        }
+      }
+
+      for(; sample < nSamples; ++sample) {
+        std::byte* rawSample = raw + sample * pitch;
+        for(size_t channel = 0; channel < nChannels; ++channel) {
+          std::memcpy(rawSample + static_cast<std::ptrdiff_t>(channel) * channelStride,
+              &scratch[channel * nSamples + sample], sizeof(RawType));
+        }
+      }
+    }
+
+    /******************************************************************************************************************/
+
+    // Number of samples per block for the given number of channels, or 0 if not even a single sample fits into the
+    // scratch buffer.
+    template<typename RawType>
+    size_t demuxBlockSamples(size_t nChannels) {
+      auto nSamples = demuxBlockBytes / sizeof(RawType) / nChannels;
+      if(nSamples >= tileSize) {
+        nSamples -= nSamples % tileSize;
+      }
+      return nSamples;
+    }
+
+  } // namespace
+
+  /********************************************************************************************************************/
+
   template<class UserType>
   NumericAddressedBackendMuxedRegisterAccessor<UserType>::NumericAddressedBackendMuxedRegisterAccessor(
       const RegisterPath& registerPathName, size_t numberOfElements, size_t elementsOffset,
@@ -93,6 +196,21 @@ namespace ChimeraTK {
           _registerInfo.channels[group.channels.front().index].bitOffset;
       assert(lastBitOffset % 8 == 0);
       group.channels.back().offsetToNext = lastBitOffset / 8;
+
+      // check whether all channels in the group are equidistant, which allows block-wise demultiplexing
+      group.isEquidistant = true;
+      if(group.channels.size() > 1) {
+        auto channelBitOffset = [&](size_t i) {
+          return static_cast<std::ptrdiff_t>(_registerInfo.channels[group.channels[i].index].bitOffset);
+        };
+        group.channelStride = (channelBitOffset(1) - channelBitOffset(0)) / 8;
+        for(size_t i = 1; i < group.channels.size() - 1; ++i) {
+          if((channelBitOffset(i + 1) - channelBitOffset(i)) / 8 != group.channelStride) {
+            group.isEquidistant = false;
+            break;
+          }
+        }
+      }
     }
 
     // compute effective numberOfElements
@@ -122,40 +240,52 @@ namespace ChimeraTK {
       buf.resize(_registerInfo.nElements);
     }
 
-    // allocate the raw io buffer. Make it one element larger to make sure we can access the last byte via int32_t*
-    _ioBuffer.resize(
-        static_cast<size_t>(_registerInfo.elementPitchBits) / 8 * _registerInfo.nElements / sizeof(int32_t) + 1);
+    // create low-level transfer element handling the actual data transfer to the hardware with raw data. Only the
+    // requested samples are covered, so accessors to different parts of the area can be merged in a TransferGroup.
+    _rawAccessor = boost::make_shared<NumericAddressedLowLevelTransferElement>(_ioDevice, _registerInfo.bar,
+        _registerInfo.address, static_cast<size_t>(_registerInfo.elementPitchBits) / 8 * _registerInfo.nElements);
   }
 
   /********************************************************************************************************************/
 
   template<class UserType>
   void NumericAddressedBackendMuxedRegisterAccessor<UserType>::doReadTransferSynchronously() {
-    assert(_registerInfo.elementPitchBits % 8 == 0);
+    _rawAccessor->readTransfer();
+  }
 
-    auto nbt = _registerInfo.elementPitchBits / 8 * _registerInfo.nElements;
-    nbt = ((nbt - 1) / 4 + 1) * 4; // round up to multiple of 4 bytes
+  /********************************************************************************************************************/
 
-    _ioDevice->read(_registerInfo.bar, _registerInfo.address, _ioBuffer.data(), nbt);
+  template<class UserType>
+  void NumericAddressedBackendMuxedRegisterAccessor<UserType>::doPreRead(TransferType type) {
+    if(!_ioDevice->isOpen()) {
+      throw ChimeraTK::logic_error("Device not opened.");
+    }
+    _rawAccessor->preRead(type);
   }
 
   /********************************************************************************************************************/
 
   template<class UserType>
-  void NumericAddressedBackendMuxedRegisterAccessor<UserType>::doPostRead(TransferType, bool hasNewData) {
-    if(hasNewData) {
-      // This will call doPostReadImpl (see below) with the proper converter for each channel group
-      for(auto& group : _channelGroups) {
-        group.converterLoopHelper->doPostRead();
-      }
+  void NumericAddressedBackendMuxedRegisterAccessor<UserType>::doPostRead(TransferType type, bool hasNewData) {
+    if(!_ioDevice->isOpen()) {
+      // do not delegate if exception was thrown by us in doPreRead
+      return;
+    }
+
+    _rawAccessor->setActiveException(this->_activeException);
+    _rawAccessor->postRead(type, hasNewData);
 
-      // it is acceptable to create the version number in post read because this accessor does not have
-      // wait_for_new_data. It is basically synchronous.
-      this->_versionNumber = {};
+    if(!hasNewData) {
+      return;
+    }
 
-      // we just read good data. Set validity back to ok if someone marked it faulty for writing.
-      this->_dataValidity = DataValidity::ok;
+    // This will call doPostReadImpl (see below) with the proper converter for each channel group
+    for(auto& group : _channelGroups) {
+      group.converterLoopHelper->doPostRead();
     }
+
+    this->_versionNumber = _rawAccessor->getVersionNumber();
+    this->_dataValidity = _rawAccessor->dataValidity();
   }
 
   /********************************************************************************************************************/
@@ -169,6 +299,26 @@ namespace ChimeraTK {
     if constexpr(!std::is_same_v<RawType, ChimeraTK::Void>) {
       auto& group = _channelGroups[channelGroupId];
 
+      // Block-wise demultiplexing for equidistant channels: transpose a block of samples into a channel-major scratch
+      // buffer, then convert each channel with the array conversion into a contiguous range of the cooked buffer.
+      auto blockSamples = demuxBlockSamples<RawType>(group.channels.size());
+      if(group.isEquidistant && blockSamples > 0) {
+        std::array<RawType, demuxBlockBytes / sizeof(RawType)> scratch;
+        const size_t pitch = _registerInfo.elementPitchBits / 8;
+        const auto* raw = rawBegin() + group.startOffset;
+
+        for(size_t first = 0; first < this->getNumberOfSamples(); first += blockSamples) {
+          auto nSamples = std::min(blockSamples, this->getNumberOfSamples() - first);
+          demultiplexBlock(raw + first * pitch, pitch, group.channelStride, group.channels.size(), nSamples,
+              scratch.data());
+          for(size_t i = 0; i < group.channels.size(); ++i) {
+            converter.toCooked(std::span<const RawType>(scratch.data() + i * nSamples, nSamples),
+                std::span<UserType>(buffer_2D[group.channels[i].index].data() + first, nSamples));
+          }
+        }
+        return;
+      }
+
       // initialise the cooked iterators with beginning of the buffer
       for(auto& channel : group.channels) {
         channel.cookedIterator = buffer_2D[channel.index].begin();
@@ -176,8 +326,7 @@ namespace ChimeraTK {
 
       // Using a raw pointer for the raw buffer... We need to move the pointer byte-wise and will do a memcpy later,
       // hence this is actually safe.
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-      auto* rawIterator = reinterpret_cast<std::byte*>(_ioBuffer.data()) + group.startOffset;
+      auto* rawIterator = rawBegin() + group.startOffset;
 
       for(size_t i = 0; i < this->getNumberOfSamples(); ++i) {
         for(auto& channel : group.channels) {
@@ -199,27 +348,43 @@ namespace ChimeraTK {
   /********************************************************************************************************************/
 
   template<class UserType>
-  bool NumericAddressedBackendMuxedRegisterAccessor<UserType>::doWriteTransfer(VersionNumber) {
-    assert(_registerInfo.elementPitchBits % 8 == 0);
-
-    auto nbt = _registerInfo.elementPitchBits / 8 * _registerInfo.nElements;
-    nbt = ((nbt - 1) / 4 + 1) * 4; // round up to multiple of 4 bytes
-
-    _ioDevice->write(_registerInfo.bar, _registerInfo.address, &(_ioBuffer[0]), nbt);
+  bool NumericAddressedBackendMuxedRegisterAccessor<UserType>::doWriteTransfer(VersionNumber versionNumber) {
+    assert(!TransferElement::_isInTransferGroup);
+    _rawAccessor->writeTransfer(versionNumber);
     return false;
   }
 
   /********************************************************************************************************************/
 
   template<class UserType>
-  void NumericAddressedBackendMuxedRegisterAccessor<UserType>::doPreWrite(TransferType, VersionNumber) {
+  void NumericAddressedBackendMuxedRegisterAccessor<UserType>::doPreWrite(
+      TransferType type, VersionNumber versionNumber) {
     if(!_ioDevice->isOpen()) {
       throw ChimeraTK::logic_error("Device not opened.");
     }
 
+    // raw accessor preWrite must be called before filling the raw buffer, as it needs to prepare the buffer in case of
+    // unaligned access and acquire the lock.
+    _rawAccessor->preWrite(type, versionNumber);
+
     for(auto& group : _channelGroups) {
       group.converterLoopHelper->doPreWrite();
     }
+
+    _rawAccessor->setDataValidity(this->_dataValidity);
+  }
+
+  /********************************************************************************************************************/
+
+  template<class UserType>
+  void NumericAddressedBackendMuxedRegisterAccessor<UserType>::doPostWrite(
+      TransferType type, VersionNumber versionNumber) {
+    if(!_ioDevice->isOpen()) {
+      // do not delegate if exception was thrown by us in doPreWrite
+      return;
+    }
+    _rawAccessor->setActiveException(this->_activeException);
+    _rawAccessor->postWrite(type, versionNumber);
   }
 
   /********************************************************************************************************************/
@@ -232,6 +397,25 @@ namespace ChimeraTK {
     if constexpr(!std::is_same_v<RawType, ChimeraTK::Void>) {
       auto& group = _channelGroups[channelGroupId];
 
+      // Block-wise multiplexing for equidistant channels, see doPostReadImpl()
+      auto blockSamples = demuxBlockSamples<RawType>(group.channels.size());
+      if(group.isEquidistant && blockSamples > 0) {
+        std::array<RawType, demuxBlockBytes / sizeof(RawType)> scratch;
+        const size_t pitch = _registerInfo.elementPitchBits / 8;
+        auto* raw = rawBegin() + group.startOffset;
+
+        for(size_t first = 0; first < this->getNumberOfSamples(); first += blockSamples) {
+          auto nSamples = std::min(blockSamples, this->getNumberOfSamples() - first);
+          for(size_t i = 0; i < group.channels.size(); ++i) {
+            converter.toRaw(std::span<const UserType>(buffer_2D[group.channels[i].index].data() + first, nSamples),
+                std::span<RawType>(scratch.data() + i * nSamples, nSamples));
+          }
+          multiplexBlock(scratch.data(), pitch, group.channelStride, group.channels.size(), nSamples,
+              raw + first * pitch);
+        }
+        return;
+      }
+
       // Vector with pairs of source iterator and destination iterator
       for(auto& channel : group.channels) {
         channel.cookedIterator = buffer_2D[channel.index].begin();
@@ -239,8 +423,7 @@ namespace ChimeraTK {
 
       // Using a raw pointer for the raw buffer... We need to move the pointer byte-wise and will do a memcpy later,
       // hence this is actually safe.
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-      auto* rawIterator = reinterpret_cast<std::byte*>(_ioBuffer.data()) + group.startOffset;
+      auto* rawIterator = rawBegin() + group.startOffset;
 
       for(size_t i = 0; i < this->getNumberOfSamples(); ++i) {
         for(auto& channel : group.channels) {
@@ -121,6 +121,13 @@ namespace ChimeraTK {
 
   template<typename UserType, bool isRaw>
   void NumericAddressedBackendRegisterAccessor<UserType, isRaw>::doPostRead(TransferType type, bool hasNewData) {
+    // the low-level element must not keep a pointer to our buffer after the transfer
+    bool isDirectRead = _isDirectRead;
+    if(_isDirectRead) {
+      _rawAccessor->_directReadTarget = nullptr;
+      _isDirectRead = false;
+    }
+
     if(!_dev->isOpen()) {
       // do not delegate if exception was thrown by us in doPreWrite
       return;
@@ -136,6 +143,10 @@ namespace ChimeraTK {
     if constexpr(!isRaw || std::is_same<UserType, std::string>::value) {
       _converterLoopHelper->doPostRead();
     }
+    else if(isDirectRead) {
+      // zero-copy variant: the data has been read directly into the spare buffer
+      buffer_2D[0].swap(_directReadBuffer);
+    }
     else {
       // optimised variant for raw transfers (unless type is a string)
       auto* itsrc = _rawAccessor->begin(_registerInfo.address);
@@ -162,6 +173,12 @@ namespace ChimeraTK {
       if constexpr(!std::is_same_v<RawType, ChimeraTK::Void>) {
         auto* begin = _rawAccessor->begin(_registerInfo.address);
         assert(begin != nullptr);
+        if(reinterpret_cast<std::uintptr_t>(begin) % alignof(RawType) == 0) {
+          // fast path: convert the whole array at once
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          converter.toCooked({reinterpret_cast<const RawType*>(begin), buffer_2D[0].size()}, buffer_2D[0]);
+          return;
+        }
         for(auto [itsrc, itdst] = std::make_pair(begin, buffer_2D[0].begin()); itdst != buffer_2D[0].end();
             itsrc += sizeof(RawType), ++itdst) {
           RawType temp;
@@ -217,6 +234,12 @@ namespace ChimeraTK {
     if constexpr(!isRaw) {
       if constexpr(!std::is_same_v<RawType, ChimeraTK::Void>) {
         auto* begin = _rawAccessor->begin(_registerInfo.address);
+        if(reinterpret_cast<std::uintptr_t>(begin) % alignof(RawType) == 0) {
+          // fast path: convert the whole array at once
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          converter.toRaw(buffer_2D[0], {reinterpret_cast<RawType*>(begin), buffer_2D[0].size()});
+          return;
+        }
         for(auto [itsrc, itdst] = std::make_pair(buffer_2D[0].begin(), begin); itsrc != buffer_2D[0].end();
             ++itsrc, itdst += sizeof(RawType)) {
           RawType temp = converter.toRaw(*itsrc);
@@ -242,6 +265,20 @@ namespace ChimeraTK {
           "NumericAddressedBackend: Reading from a non-readable register is not allowed (Register name: " +
           _registerInfo.getRegisterName() + ").");
     }
+
+    if constexpr(isRaw && !std::is_same<UserType, std::string>::value) {
+      // Let the low-level element read directly into our spare buffer, if it is used exclusively by us (i.e. not
+      // merged in a TransferGroup) and covers exactly our data.
+      if(!_rawAccessor->isShared && !_rawAccessor->_isUnaligned &&
+          _rawAccessor->_startAddress == _registerInfo.address &&
+          _rawAccessor->_numberOfBytes == buffer_2D[0].size() * sizeof(UserType)) {
+        _directReadBuffer.resize(buffer_2D[0].size());
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _rawAccessor->_directReadTarget = reinterpret_cast<uint8_t*>(_directReadBuffer.data());
+        _isDirectRead = true;
+      }
+    }
+
     _rawAccessor->preRead(type);
   }
 
@@ -333,11 +370,7 @@ namespace ChimeraTK {
       boost::shared_ptr<TransferElement> newElement) {
     auto casted = boost::dynamic_pointer_cast<NumericAddressedLowLevelTransferElement>(newElement);
     if(casted && casted->isMergeable(_rawAccessor)) {
-      size_t newStartAddress = std::min(casted->_startAddress, _rawAccessor->_startAddress);
-      size_t newStopAddress = std::max(
-          casted->_startAddress + casted->_numberOfBytes, _rawAccessor->_startAddress + _rawAccessor->_numberOfBytes);
-      size_t newNumberOfBytes = newStopAddress - newStartAddress;
-      casted->changeAddress(newStartAddress, newNumberOfBytes);
+      casted->mergeWith(*_rawAccessor);
       _rawAccessor = casted;
     }
     _rawAccessor->setExceptionBackend(this->_exceptionBackend);
@@ -4,6 +4,7 @@
 #include "NumericAddressedRegisterCatalogue.h"
 
 #include "async/DataConsistencyRealmStore.h"
+#include "async/Domain.h"
 #include "Exception.h"
 #include "MapFileParser.h"
 #include "NumericAddress.h"
@@ -240,6 +241,10 @@ namespace ChimeraTK {
       return NumericAddressedRegisterInfo(path, nElements, address, nBytes, bar);
     }
     if(path.startsWith("!")) {
+      if(getAsyncDomainStatisticsRegister(path)) {
+        return NumericAddressedRegisterInfo(path, 1, 0, sizeof(uint64_t), 0, 64, 0, false,
+            NumericAddressedRegisterInfo::Access::READ_ONLY, NumericAddressedRegisterInfo::Type::FIXED_POINT);
+      }
       auto canonicalInterrupt = _canonicalInterrupts.find(path);
       if(canonicalInterrupt == _canonicalInterrupts.end()) {
         throw ChimeraTK::logic_error("Illegal canonical interrupt path: '" + (path) + "'");
@@ -261,11 +266,40 @@ namespace ChimeraTK {
     if(_canonicalInterrupts.find(registerPathName) != _canonicalInterrupts.end()) {
       return true;
     }
+    if(getAsyncDomainStatisticsRegister(registerPathName)) {
+      return true;
+    }
     return BackendRegisterCatalogue::hasRegister(registerPathName);
   }
 
   /********************************************************************************************************************/
 
+  std::optional<std::pair<size_t, std::string>> NumericAddressedRegisterCatalogue::getAsyncDomainStatisticsRegister(
+      const RegisterPath& registerPathName) const {
+    // cheap check first, since this is called for every register lookup
+    if(registerPathName.getNormalised().compare(0, 2, "/!") != 0) {
+      return std::nullopt;
+    }
+    auto components = registerPathName.getComponents();
+    if(components.size() != 2 || components[0].empty() || components[0][0] != '!') {
+      return std::nullopt;
+    }
+    // only primary interrupts have their own async::Domain
+    auto canonicalInterrupt = _canonicalInterrupts.find(RegisterPath(components[0]));
+    if(canonicalInterrupt == _canonicalInterrupts.end() || canonicalInterrupt->second.size() != 1) {
+      return std::nullopt;
+    }
+    const auto& name = components[1];
+    if(name != async::statistics::INTERRUPT_COUNT && name != async::statistics::MISSED_INTERRUPT_COUNT &&
+        name != async::statistics::DISTRIBUTION_LATENCY_NS && name != async::statistics::QUEUE_OVERFLOW_COUNT &&
+        name != async::statistics::BUFFER_RESIZE_COUNT) {
+      return std::nullopt;
+    }
+    return std::make_pair(canonicalInterrupt->second.front(), name);
+  }
+
+  /********************************************************************************************************************/
+
   const std::set<std::vector<size_t>>& NumericAddressedRegisterCatalogue::getListOfInterrupts() const {
     return _listOfInterrupts;
   }
@@ -310,6 +344,7 @@ namespace ChimeraTK {
   void NumericAddressedRegisterCatalogue::addDataConsistencyRealm(
       const RegisterPath& registerPath, const std::string& realmName) {
     _dataConsistencyRealms[registerPath] = realmName;
+    markModified();
   }
 
   /********************************************************************************************************************/
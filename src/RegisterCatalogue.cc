@@ -13,7 +13,12 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  RegisterCatalogue::RegisterCatalogue(const RegisterCatalogue& other) : _impl(other._impl->clone()) {}
+  RegisterCatalogue::RegisterCatalogue(std::shared_ptr<const BackendRegisterCatalogueBase> impl)
+  : _impl(std::move(impl)) {}
+
+  /********************************************************************************************************************/
+
+  RegisterCatalogue::RegisterCatalogue(const RegisterCatalogue& other) = default;
 
   /********************************************************************************************************************/
 
@@ -21,12 +26,7 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  RegisterCatalogue& RegisterCatalogue::operator=(const RegisterCatalogue& other) {
-    if(this != &other) {
-      _impl = other._impl->clone();
-    }
-    return *this;
-  }
+  RegisterCatalogue& RegisterCatalogue::operator=(const RegisterCatalogue& other) = default;
 
   /********************************************************************************************************************/
 
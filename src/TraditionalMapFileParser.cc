@@ -21,7 +21,7 @@ namespace ChimeraTK::detail {
   /********************************************************************************************************************/
 
   std::pair<NumericAddressedRegisterCatalogue, MetadataCatalogue> TraditionalMapFileParser::parse(
-      std::ifstream& stream) {
+      std::istream& stream) {
     std::string line;
     while(std::getline(stream, line)) {
       _lineNo++;
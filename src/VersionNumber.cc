@@ -3,11 +3,27 @@
 
 #include "VersionNumber.h"
 
+#include <ctime>
+
 namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
   std::atomic<uint64_t> VersionNumber::_lastGeneratedVersionNumber{0};
+  std::atomic<VersionNumber::Clock> VersionNumber::_clock{VersionNumber::Clock::precise};
+
+  /********************************************************************************************************************/
+
+  std::chrono::system_clock::time_point VersionNumber::coarseNow() {
+#ifdef CLOCK_REALTIME_COARSE
+    timespec ts{};
+    if(clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0) {
+      return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec)));
+    }
+#endif
+    return std::chrono::system_clock::now();
+  }
 
   /********************************************************************************************************************/
 
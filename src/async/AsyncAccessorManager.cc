@@ -3,6 +3,8 @@
 
 #include "async/AsyncAccessorManager.h"
 
+#include <ChimeraTK/cppext/finally.hpp>
+
 namespace ChimeraTK::async {
 
   thread_local AsyncAccessorManager* AsyncAccessorManager::_isHoldingDomainLock{nullptr};
@@ -10,12 +12,14 @@ namespace ChimeraTK::async {
   /********************************************************************************************************************/
   void AsyncAccessorManager::unsubscribeImpl(TransferElementID id) {
     asyncVariableMapChanged(id);
+    _asyncDomain->unsafeRemoveBlockingQueue(id);
     // The destructor of the AsyncVariable implementation must do all necessary clean-up
     _asyncVariables.erase(id);
   }
   /********************************************************************************************************************/
   void AsyncAccessorManager::unsubscribe(TransferElementID id) {
     if(_isHoldingDomainLock == this) {
+      std::lock_guard<std::mutex> lock(_delayedUnsubscriptionsMutex);
       _delayedUnsubscriptions.push_back(id);
     }
     else {
@@ -24,6 +28,40 @@ namespace ChimeraTK::async {
     }
   }
 
+  /********************************************************************************************************************/
+  void AsyncAccessorManager::fillAndSendAll() {
+    assert(_delayedUnsubscriptions.empty());
+
+    auto* executor = _asyncDomain->unsafeGetDistributionExecutor();
+    if(executor && _asyncVariables.size() > 1) {
+      _distributionList.clear();
+      for(auto& var : _asyncVariables) {
+        _distributionList.push_back(var.second.get());
+      }
+      auto finally = cppext::finally([&] { _distributionList.clear(); });
+      executor->run(_distributionList.size(), [this](size_t i) {
+        _distributionList[i]->fillSendBuffer();
+        // _isHoldingDomainLock is thread local, so it must be set in each worker thread
+        _isHoldingDomainLock = this;
+        auto resetHoldingDomainLock = cppext::finally([] { _isHoldingDomainLock = nullptr; });
+        _distributionList[i]->send();
+      });
+    }
+    else {
+      for(auto& var : _asyncVariables) {
+        var.second->fillSendBuffer();
+        _isHoldingDomainLock = this;
+        var.second->send(); // function from  the AsyncVariable base class
+        _isHoldingDomainLock = nullptr;
+      }
+    }
+
+    for(auto id : _delayedUnsubscriptions) {
+      unsubscribeImpl(id);
+    }
+    _delayedUnsubscriptions.clear();
+  }
+
   /********************************************************************************************************************/
   void AsyncAccessorManager::sendException(const std::exception_ptr& e) {
     _isHoldingDomainLock = this;
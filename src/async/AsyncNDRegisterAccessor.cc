@@ -5,6 +5,8 @@
 
 #include "async/AsyncAccessorManager.h"
 
+#include <algorithm>
+
 namespace ChimeraTK::async {
 
   template<typename UserType>
@@ -19,7 +21,9 @@ namespace ChimeraTK::async {
       std::string const& description)
 
   : NDRegisterAccessor<UserType>(name, accessModeFlags, unit, description), _backend(std::move(backend)),
-    _accessorManager(std::move(manager)), _asyncDomain(std::move(asyncDomain)), _receiveBuffer(nChannels, nElements) {
+    _accessorManager(std::move(manager)), _asyncDomain(std::move(asyncDomain)), _receiveBuffer(nChannels, nElements),
+    _queueLength(computeQueueLength(_asyncDomain->unsafeGetQueuePolicy(), nChannels, nElements)),
+    _overflowPolicy(_asyncDomain->unsafeGetQueuePolicy().overflowPolicy) {
     // Don't throw a ChimeraTK::logic_error here. They are for mistakes an application is doing when using DeviceAccess.
     // If an AsyncNDRegisterAccessor is created without wait_for_new_data it is a mistake in the backend, which is not
     // part of the application.
@@ -31,7 +35,7 @@ namespace ChimeraTK::async {
     // * write once and then read,
     // * repeat n+1 times to make sure all buffers inside the queue have been replaced with
     //   a properly sized buffer, so it can be swapped out and used for data
-    for(size_t i = 0; i < _queueSize + 1; ++i) {
+    for(size_t i = 0; i < _queueLength + 1; ++i) {
       Buffer b1(nChannels, nElements);
       _dataTransportQueue.push(std::move(b1));
       Buffer b2(nChannels, nElements);
@@ -40,11 +44,22 @@ namespace ChimeraTK::async {
 
     this->_readQueue = _dataTransportQueue.template then<void>(
         [&](Buffer& buf) { std::swap(_receiveBuffer, buf); }, std::launch::deferred);
+
+    // The distribution waits for space in the queue before acquiring the domain lock, see Domain::waitForQueueSpace().
+    // The entry is removed by the AsyncAccessorManager when unsubscribing.
+    if(_overflowPolicy == QueueOverflowPolicy::blockProducer) {
+      _asyncDomain->unsafeAddBlockingQueue(
+          this->getId(), [this] { return _dataTransportQueue.read_available() < _queueLength; });
+    }
   }
 
   /********************************************************************************************************************/
   template<typename UserType>
   void AsyncNDRegisterAccessor<UserType>::doPostRead([[maybe_unused]] TransferType type, bool updateDataBuffer) {
+    if(_overflowPolicy == QueueOverflowPolicy::blockProducer) {
+      // a value has been taken from the queue (or an exception), so a waiting distribution can continue
+      _asyncDomain->notifyQueueSpace();
+    }
     if(updateDataBuffer) {
       // do not update meta data if updateDataBuffer == false, since this is the equivalent to a backend
       // implementation, not a decorator
@@ -56,15 +71,61 @@ namespace ChimeraTK::async {
       auto destination = this->buffer_2D.begin();
       for(; source != _receiveBuffer.value.end(); ++source, ++destination) {
         destination->swap(*source);
+        // The vector swapped out of the user buffer goes back into the queue, to be filled by the distribution. The
+        // application might have replaced or resized it, so its size is restored here in the application thread. Hence
+        // the distribution never needs to allocate memory.
+        if(source->size() != destination->size()) {
+          source->resize(destination->size());
+          _asyncDomain->countBufferResize();
+        }
       }
     }
   }
 
+  /********************************************************************************************************************/
+  template<typename UserType>
+  size_t AsyncNDRegisterAccessor<UserType>::computeQueueLength(
+      const QueuePolicy& policy, size_t nChannels, size_t nElements) {
+    auto length = std::max<size_t>(policy.length, 1);
+    if(policy.maxBytes > 0) {
+      auto bytesPerValue = std::max<size_t>(nChannels * nElements * sizeof(UserType), 1);
+      length = std::clamp<size_t>(policy.maxBytes / bytesPerValue, 1, length);
+    }
+    return length;
+  }
+
   /********************************************************************************************************************/
   template<typename UserType>
   void AsyncNDRegisterAccessor<UserType>::sendDestructively(typename NDRegisterAccessor<UserType>::Buffer& data) {
-    if(_asyncDomain->unsafeGetIsActive()) {
-      _dataTransportQueue.push_overwrite(std::move(data));
+    if(!_asyncDomain->unsafeGetIsActive()) {
+      return;
+    }
+
+    // The buffer swapped out of the queue always has the right shape, since doPostRead() restores the shape of the
+    // vectors coming back from the application. The producer can fill it without allocations.
+    pushToQueue(data);
+  }
+
+  /********************************************************************************************************************/
+  template<typename UserType>
+  void AsyncNDRegisterAccessor<UserType>::pushToQueue(Buffer& data) {
+    switch(_overflowPolicy) {
+      case QueueOverflowPolicy::overwriteNewest:
+      case QueueOverflowPolicy::blockProducer:
+        // With blockProducer, the distribution has already waited for space in the queue before acquiring the domain
+        // lock. Waiting here would block the entire domain, so a value which still finds the queue full is treated
+        // like with overwriteNewest.
+        if(!_dataTransportQueue.push_overwrite(std::move(data))) {
+          ++_overflowCount;
+          _asyncDomain->countQueueOverflow();
+        }
+        return;
+      case QueueOverflowPolicy::dropNewest:
+        if(!_dataTransportQueue.push(std::move(data))) {
+          ++_overflowCount;
+          _asyncDomain->countQueueOverflow();
+        }
+        return;
     }
   }
 
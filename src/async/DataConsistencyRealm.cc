@@ -27,8 +27,9 @@ namespace ChimeraTK::async {
     // special case: map is empty right now, we need to make the first entries.
     if(_versionHistory.empty()) {
       auto nElementsToInsert = std::min(DataConsistencyKey::BaseType(eventId), maxSizeEventIdMap);
+      VersionNumber::Batch versions(nElementsToInsert);
       for(size_t i = 0; i < nElementsToInsert; ++i) {
-        _versionHistory.push_back({});
+        _versionHistory.push_back(versions.next());
       }
       _latestKey = eventId;
 
@@ -45,9 +46,10 @@ namespace ChimeraTK::async {
     // determine how many elements to insert (according to spec B.3.1.3.2 we must not leave any gaps)
     auto nElementsToInsert = std::min((eventId - _latestKey), maxSizeEventIdMap);
 
-    // insert new entries
+    // insert new entries. They share the time stamp, since filling the gaps happens in one go anyway.
+    VersionNumber::Batch versions(nElementsToInsert);
     for(size_t i = 0; i < nElementsToInsert; ++i) {
-      _versionHistory.push_back(VersionNumber{});
+      _versionHistory.push_back(versions.next());
     }
     _latestKey = eventId;
 
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "async/DistributionExecutor.h"
+
+#include <utility>
+
+namespace ChimeraTK::async {
+
+  /********************************************************************************************************************/
+
+  DistributionExecutor::DistributionExecutor(size_t nThreads) {
+    _threads.reserve(nThreads);
+    for(size_t i = 0; i < nThreads; ++i) {
+      _threads.emplace_back([this] { workerLoop(); });
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  DistributionExecutor::~DistributionExecutor() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _shutdown = true;
+    }
+    _workAvailable.notify_all();
+    for(auto& t : _threads) {
+      t.join();
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void DistributionExecutor::run(size_t nTasks, const std::function<void(size_t)>& task) {
+    if(nTasks == 0) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> runLock(_runMutex);
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _task = &task;
+      _nTasks = nTasks;
+      _nextTask = 0;
+      ++_generation;
+    }
+    _workAvailable.notify_all();
+
+    processTasks(&task, nTasks);
+
+    // All tasks have been picked up. Wait until the workers are done with theirs.
+    std::unique_lock<std::mutex> lock(_mutex);
+    _workDone.wait(lock, [&] { return _nBusyWorkers == 0; });
+    _task = nullptr;
+    _nTasks = 0;
+    if(_firstException) {
+      std::rethrow_exception(std::exchange(_firstException, nullptr));
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void DistributionExecutor::workerLoop() {
+    uint64_t lastGeneration{0};
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(true) {
+      _workAvailable.wait(lock, [&] { return _shutdown || _generation != lastGeneration; });
+      if(_shutdown) {
+        return;
+      }
+      lastGeneration = _generation;
+
+      // Copy the task under the lock. If the worker wakes up late, run() might already have returned, in which case
+      // there are no tasks left.
+      const auto* task = _task;
+      auto nTasks = _nTasks;
+      ++_nBusyWorkers;
+      lock.unlock();
+
+      processTasks(task, nTasks);
+
+      lock.lock();
+      if(--_nBusyWorkers == 0) {
+        _workDone.notify_all();
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void DistributionExecutor::processTasks(const std::function<void(size_t)>* task, size_t nTasks) {
+    if(!task) {
+      // Woke up after run() has returned. Do not touch _nextTask, a new run() might be about to reset it.
+      return;
+    }
+    for(size_t i = _nextTask++; i < nTasks; i = _nextTask++) {
+      try {
+        (*task)(i);
+      }
+      catch(...) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(!_firstException) {
+          _firstException = std::current_exception();
+        }
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::async
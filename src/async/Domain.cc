@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#include "async/Domain.h"
+
+#include "Exception.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace ChimeraTK::async {
+
+  /********************************************************************************************************************/
+
+  uint64_t Domain::getStatistics(const std::string& name) const {
+    if(name == statistics::INTERRUPT_COUNT) {
+      return getInterruptCount();
+    }
+    if(name == statistics::MISSED_INTERRUPT_COUNT) {
+      return getMissedInterruptCount();
+    }
+    if(name == statistics::DISTRIBUTION_LATENCY_NS) {
+      return getDistributionLatencyNs();
+    }
+    if(name == statistics::QUEUE_OVERFLOW_COUNT) {
+      return getQueueOverflowCount();
+    }
+    if(name == statistics::BUFFER_RESIZE_COUNT) {
+      return getBufferResizeCount();
+    }
+    throw ChimeraTK::logic_error("Unknown async::Domain statistics register '" + name + "'.");
+  }
+
+  /********************************************************************************************************************/
+
+  std::chrono::steady_clock::time_point Domain::beginDistribution() {
+    ++_interruptCount;
+
+    auto now = std::chrono::steady_clock::now();
+    auto interval = _minimumDistributionIntervalNs.load();
+    if(interval > 0) {
+      auto nextAllowed = std::chrono::steady_clock::time_point(
+          std::chrono::nanoseconds(_lastDistributionStartNs.load() + interval));
+      if(now < nextAllowed) {
+        std::this_thread::sleep_until(nextAllowed);
+        now = std::chrono::steady_clock::now();
+      }
+    }
+    _lastDistributionStartNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+    return now;
+  }
+
+  /********************************************************************************************************************/
+
+  void Domain::distributionDone(std::chrono::steady_clock::time_point start) {
+    _distributionLatencyNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  /********************************************************************************************************************/
+
+  void Domain::waitForQueueSpace() {
+    while(true) {
+      // Obtain the generation before checking the queues, so a notification sent during the check is not missed.
+      uint64_t generation;
+      {
+        std::lock_guard<std::mutex> l(_queueSpaceMutex);
+        generation = _queueSpaceGeneration;
+      }
+      {
+        std::lock_guard<std::mutex> l(_mutex);
+        if(!_isActive || std::all_of(_blockingQueues.begin(), _blockingQueues.end(),
+                             [](const auto& idAndHasSpace) { return idAndHasSpace.second(); })) {
+          return;
+        }
+      }
+      std::unique_lock<std::mutex> l(_queueSpaceMutex);
+      _queueSpaceCondition.wait(l, [&] { return _queueSpaceGeneration != generation; });
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void Domain::notifyQueueSpace() {
+    {
+      std::lock_guard<std::mutex> l(_queueSpaceMutex);
+      ++_queueSpaceGeneration;
+    }
+    _queueSpaceCondition.notify_all();
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::async
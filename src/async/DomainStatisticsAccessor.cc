@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "async/DomainStatisticsAccessor.h"
+
+#include "DeviceBackend.h"
+
+namespace ChimeraTK::async {
+
+  /********************************************************************************************************************/
+
+  template<typename UserType>
+  DomainStatisticsAccessor<UserType>::DomainStatisticsAccessor(boost::shared_ptr<DeviceBackend> backend,
+      std::function<uint64_t(void)> getValue, const RegisterPath& registerPathName, size_t numberOfElements,
+      size_t elementsOffset, const AccessModeFlags& flags)
+  : NDRegisterAccessor<UserType>(registerPathName, {}), _backend(std::move(backend)), _getValue(std::move(getValue)) {
+    if(numberOfElements > 1) {
+      throw ChimeraTK::logic_error("Register " + registerPathName + " can have at most one element");
+    }
+
+    if(elementsOffset != 0) {
+      throw ChimeraTK::logic_error("Register " + registerPathName + " cannot have any offset");
+    }
+
+    flags.checkForUnknownFlags({});
+
+    NDRegisterAccessor<UserType>::buffer_2D.resize(1);
+    NDRegisterAccessor<UserType>::buffer_2D[0].resize(1);
+    NDRegisterAccessor<UserType>::buffer_2D[0][0] = numericToUserType<UserType>(0);
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType>
+  void DomainStatisticsAccessor<UserType>::doPreRead(TransferType) {
+    if(!_backend->isOpen()) {
+      throw ChimeraTK::logic_error("Device is not opened.");
+    }
+    _backend->checkActiveException();
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType>
+  void DomainStatisticsAccessor<UserType>::doReadTransferSynchronously() {
+    _value = _getValue();
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType>
+  void DomainStatisticsAccessor<UserType>::doPostRead(TransferType, bool hasNewData) {
+    if(!hasNewData) {
+      return;
+    }
+    NDRegisterAccessor<UserType>::buffer_2D[0][0] = numericToUserType<UserType>(_value);
+    this->_versionNumber = {};
+    this->_dataValidity = DataValidity::ok;
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType>
+  void DomainStatisticsAccessor<UserType>::doPreWrite(TransferType, VersionNumber) {
+    throw ChimeraTK::logic_error("Cannot write to read-only register " + this->getName() + ".");
+  }
+
+  /********************************************************************************************************************/
+
+  INSTANTIATE_TEMPLATE_FOR_CHIMERATK_USER_TYPES(DomainStatisticsAccessor);
+} // namespace ChimeraTK::async
@@ -98,4 +98,43 @@ namespace ChimeraTK::async {
     }
   }
 
+  /********************************************************************************************************************/
+
+  void DomainsContainer::setDistributionExecutor(const std::shared_ptr<DistributionExecutor>& executor) {
+    std::lock_guard<std::mutex> domainsLock(_domainsMutex);
+    _distributionExecutor = executor;
+    for(auto& keyAndDomain : _domains) {
+      auto domain = keyAndDomain.second.lock();
+      if(domain) {
+        domain->setDistributionExecutor(executor);
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void DomainsContainer::setMinimumDistributionInterval(std::chrono::nanoseconds interval) {
+    std::lock_guard<std::mutex> domainsLock(_domainsMutex);
+    _minimumDistributionInterval = interval;
+    for(auto& keyAndDomain : _domains) {
+      auto domain = keyAndDomain.second.lock();
+      if(domain) {
+        domain->setMinimumDistributionInterval(interval);
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void DomainsContainer::setQueuePolicy(const QueuePolicy& policy) {
+    std::lock_guard<std::mutex> domainsLock(_domainsMutex);
+    _queuePolicy = policy;
+    for(auto& keyAndDomain : _domains) {
+      auto domain = keyAndDomain.second.lock();
+      if(domain) {
+        domain->setQueuePolicy(policy);
+      }
+    }
+  }
+
 } // namespace ChimeraTK::async
@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "async/InterruptEventFile.h"
+
+#include "Exception.h"
+
+#include <sys/stat.h>
+
+#include <boost/asio.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <utility>
+
+namespace io = boost::asio;
+
+namespace ChimeraTK::async {
+
+  /********************************************************************************************************************/
+
+  // Thread waiting for events on the InterruptEventFile and distributing them to the async domain
+  class InterruptEventFile::EventThread {
+   public:
+    EventThread(InterruptEventFile& owner, std::promise<void> subscriptionDonePromise);
+    ~EventThread();
+
+   private:
+    void start(std::promise<void> subscriptionDonePromise);
+    void waitForEvent();
+    void readEvent(const boost::system::error_code& ec);
+    void handleEvent(const boost::system::error_code& ec, std::size_t bytesTransferred);
+    void timerEvent(const boost::system::error_code& ec);
+
+    static constexpr int timerSleepSec = 1;
+
+    InterruptEventFile& _owner;
+    io::io_context _ctx;
+    io::posix::stream_descriptor _sd;
+    io::steady_timer _timer{_ctx};
+    std::array<uint32_t, 1> _result{};
+    std::thread _thread;
+  };
+
+  /********************************************************************************************************************/
+
+  InterruptEventFile::EventThread::EventThread(InterruptEventFile& owner, std::promise<void> subscriptionDonePromise)
+  : _owner{owner}, _sd{_ctx, owner._fd}, _thread{&EventThread::start, this, std::move(subscriptionDonePromise)} {
+#ifdef _DEBUG
+    std::cout << "InterruptEventFile: thread for " << _owner._path << " started\n";
+#endif
+  }
+
+  /********************************************************************************************************************/
+
+  InterruptEventFile::EventThread::~EventThread() {
+    _ctx.stop();
+    _thread.join();
+    // the file descriptor is owned by the InterruptEventFile
+    _sd.release();
+#ifdef _DEBUG
+    std::cout << "InterruptEventFile: thread for " << _owner._path << " stopped\n";
+#endif
+  }
+
+  /********************************************************************************************************************/
+
+  void InterruptEventFile::EventThread::start(std::promise<void> subscriptionDonePromise) {
+    // The thread has started, next thing is going to be the wait.
+    // This is the time to fulfil the promise that the subscription is done.
+    subscriptionDonePromise.set_value();
+    waitForEvent();
+    // We also put timeout handlers for a concurrently running timer into the same context, and check the health
+    // state of our event file from there.
+    _timer.expires_after(std::chrono::seconds(timerSleepSec));
+    _timer.async_wait([&](auto ec) { timerEvent(ec); });
+
+    try {
+      _ctx.run();
+    }
+    catch(runtime_error& e) {
+      // forward exception to backend client
+      _owner._backend->setException(e.what());
+      // we leave device in non-functional state. next call to open() will reinit and clear exception.
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void InterruptEventFile::EventThread::waitForEvent() {
+    // We have to wait seperately from the read operation,
+    // since the read op will not be canceled by _ctx.stop() in the dtor
+    _sd.async_wait(io::posix::stream_descriptor::wait_read, [this](auto ec) { readEvent(ec); });
+  }
+
+  /********************************************************************************************************************/
+
+  void InterruptEventFile::EventThread::readEvent(const boost::system::error_code& ec) {
+    if(ec) {
+      throw runtime_error("Interrupt event file " + _owner._path + ": I/O error while waiting: " + ec.message());
+    }
+    _sd.async_read_some(io::buffer(_result), [this](auto ec_, auto n) { handleEvent(ec_, n); });
+  }
+
+  /********************************************************************************************************************/
+
+  void InterruptEventFile::EventThread::handleEvent(
+      const boost::system::error_code& ec, std::size_t bytesTransferred) {
+    if(ec) {
+      throw runtime_error("Interrupt event file " + _owner._path + ": I/O error while reading: " + ec.message());
+    }
+    if(bytesTransferred != sizeof(_result[0])) {
+      throw runtime_error("Interrupt event file " + _owner._path + ": incomplete read");
+    }
+
+    uint32_t numInterrupts = _result[0];
+#ifdef _DEBUG
+    std::cout << "InterruptEventFile: " << _owner._path << " received " << numInterrupts << " interrupts\n";
+#endif
+    // Only distribute once. If numInterrupts is > 1, the additional interrupts are counted as missed.
+    if(numInterrupts != 0) {
+      _owner._asyncDomain->reportMissedInterrupts(numInterrupts - 1);
+      _owner._asyncDomain->distribute(nullptr);
+    }
+    waitForEvent();
+  }
+
+  /********************************************************************************************************************/
+
+  void InterruptEventFile::EventThread::timerEvent(const boost::system::error_code& ec) {
+    if(ec) {
+      throw runtime_error("Interrupt event file " + _owner._path + ": timer error: " + ec.message());
+    }
+    if(!_owner.goodState()) {
+      throw runtime_error("Interrupt event file " + _owner._path + " has disappeared");
+    }
+    _timer.expires_after(std::chrono::seconds(timerSleepSec));
+    _timer.async_wait([&](auto ec_) { timerEvent(ec_); });
+  }
+
+  /********************************************************************************************************************/
+  /********************************************************************************************************************/
+
+  InterruptEventFile::InterruptEventFile(
+      DeviceBackend* backend, std::string path, boost::shared_ptr<DomainImpl<std::nullptr_t>> asyncDomain)
+  : _backend(backend), _path(std::move(path)), _fd(::open(_path.c_str(), O_RDONLY)),
+    _asyncDomain{std::move(asyncDomain)} {
+    if(_fd < 0) {
+      char errorBuffer[255];
+      throw runtime_error("Cannot open interrupt event file " + _path + ": " +
+          ::strerror_r(errno, errorBuffer, sizeof(errorBuffer)));
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  InterruptEventFile::~InterruptEventFile() {
+    _eventThread.reset();
+    ::close(_fd);
+  }
+
+  /********************************************************************************************************************/
+
+  bool InterruptEventFile::goodState() const {
+    struct stat s {};
+    if(::fstat(_fd, &s) != 0) {
+      return false;
+    }
+    // check whether the file was deleted since opened
+    return s.st_nlink > 0;
+  }
+
+  /********************************************************************************************************************/
+
+  void InterruptEventFile::startThread(std::promise<void> subscriptionDonePromise) {
+    if(_eventThread) {
+      subscriptionDonePromise.set_value();
+      return;
+    }
+    _eventThread = std::make_unique<EventThread>(*this, std::move(subscriptionDonePromise));
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::async
@@ -14,8 +14,7 @@ namespace ChimeraTK {
 
     virtual void singleWordWrite(std::vector<uint32_t>& buffer) override;
     virtual void multiWordRead(std::vector<uint32_t>& buffer) override;
-    virtual uint32_t multiWordWrite(std::vector<uint32_t>& buffer) override;
-    virtual uint32_t continueMultiWordWrite(std::vector<uint32_t>& buffer) override;
+    virtual void multiWordWrite(std::vector<uint32_t>& buffer) override;
 
     virtual void hello(std::vector<uint32_t>& buffer) override;
     virtual void ping(std::vector<uint32_t>& buffer) override;
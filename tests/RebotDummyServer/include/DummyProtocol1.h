@@ -15,19 +15,14 @@ namespace ChimeraTK {
     /// The multi word read is not limited in the size any more
     void multiWordRead(std::vector<uint32_t>& buffer) override;
 
-    /// First protocol version that implements hello
-    uint32_t multiWordWrite(std::vector<uint32_t>& buffer) override;
-    uint32_t continueMultiWordWrite(std::vector<uint32_t>& buffer) override;
+    /// First protocol version that implements multi word write
+    void multiWordWrite(std::vector<uint32_t>& buffer) override;
 
     /// First protocol version that implements hello
     void hello(std::vector<uint32_t>& buffer) override;
 
     uint32_t protocolVersion() const override { return 1; }
 
-    // part of the multi word write across many packets
-    uint32_t _nextAddressInWords;
-    uint32_t _nWordsLeft;
-
     static const uint64_t BAR = 0;
   };
 
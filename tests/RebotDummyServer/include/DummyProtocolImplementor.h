@@ -9,10 +9,8 @@
 struct DummyProtocolImplementor {
   virtual void singleWordWrite(std::vector<uint32_t>& buffer) = 0;
   virtual void multiWordRead(std::vector<uint32_t>& buffer) = 0;
-  // returns a new state: it might be that the next packet is still from the
-  // same write operation, so we are not ready for a new command.
-  virtual uint32_t multiWordWrite(std::vector<uint32_t>& buffer) = 0;
-  virtual uint32_t continueMultiWordWrite(std::vector<uint32_t>& buffer) = 0;
+  // the buffer always contains the complete command including all data words
+  virtual void multiWordWrite(std::vector<uint32_t>& buffer) = 0;
 
   virtual void hello(std::vector<uint32_t>& buffer) = 0;
   virtual void ping(std::vector<uint32_t>& buffer) = 0;
@@ -47,27 +47,30 @@ namespace ChimeraTK {
     static const uint32_t PING = 5;
     static const uint32_t REBOT_MAGIC_WORD = 0x72626f74; // ascii code 'rbot'
 
-    // internal states. Currently there are only two when the connection is open
-    static const uint32_t ACCEPT_NEW_COMMAND = 1;
-    // a multi word write can be so large that it needs more than one package
-    static const uint32_t INSIDE_MULTI_WORD_WRITE = 2;
-
-    // The actual state: ready for new command or not
-    uint32_t _state;
+    // all commands start with a header of three words. Multi word writes are followed by the data.
+    static const size_t COMMAND_HEADER_SIZE_IN_WORDS = 3;
 
     std::atomic<uint32_t> _heartbeatCount;
     std::atomic<uint32_t> _helloCount; // in protocol version 1 we have to send
                                        // hello instead of heartbeat
     std::atomic<bool> _dont_answer;    // flag to cause an error condition
+    // Maximum number of commands received before the responses were sent, i.e. the maximum number of requests the
+    // client had in flight at the same time. Used to test the pipelining of the client.
+    std::atomic<uint32_t> _maxRequestsInFlight;
     std::shared_ptr<DummyBackend> _registerSpace;
     std::vector<uint32_t> _dataBuffer;
 
+    // Received bytes which do not form a complete command yet. A client may send several commands back to back, and
+    // a large command may be split across several packets.
+    std::vector<uint8_t> _receivedData;
+
     unsigned int _serverPort;
     unsigned int _protocolVersion;
     ip::tcp::socket _currentClientConnection;
     std::unique_ptr<DummyProtocolImplementor> _protocolImplementor;
 
-    void processReceivedPackage(std::vector<uint32_t>& buffer);
+    void processReceivedData();
+    void processCommand(std::vector<uint32_t>& buffer);
     void writeWordToRequestedAddress(std::vector<uint32_t>& buffer);
     void readRegisterAndSendData(std::vector<uint32_t>& buffer);
 
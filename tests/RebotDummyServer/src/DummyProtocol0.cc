@@ -27,14 +27,8 @@ namespace ChimeraTK {
     }
   }
 
-  uint32_t DummyProtocol0::multiWordWrite(std::vector<uint32_t>& /*buffer*/) {
+  void DummyProtocol0::multiWordWrite(std::vector<uint32_t>& /*buffer*/) {
     _parent.sendSingleWord(RebotDummySession::UNKNOWN_INSTRUCTION);
-    return RebotDummySession::ACCEPT_NEW_COMMAND;
-  }
-
-  uint32_t DummyProtocol0::continueMultiWordWrite(std::vector<uint32_t>& /*buffer*/) {
-    // we never should end here. Don't do anything
-    return RebotDummySession::ACCEPT_NEW_COMMAND;
   }
 
   void DummyProtocol0::hello(std::vector<uint32_t>& /*buffer*/) {
@@ -9,8 +9,7 @@
 
 namespace ChimeraTK {
 
-  DummyProtocol1::DummyProtocol1(RebotDummySession& parent)
-  : DummyProtocol0(parent), _nextAddressInWords(0), _nWordsLeft(0) {}
+  DummyProtocol1::DummyProtocol1(RebotDummySession& parent) : DummyProtocol0(parent) {}
 
   void DummyProtocol1::multiWordRead(std::vector<uint32_t>& buffer) {
     _parent.readRegisterAndSendData(buffer);
@@ -23,52 +22,17 @@ namespace ChimeraTK {
     _parent.write({RebotDummySession::HELLO, RebotDummySession::REBOT_MAGIC_WORD, protocolVersion()});
   }
 
-  uint32_t DummyProtocol1::multiWordWrite(std::vector<uint32_t>& buffer) {
+  void DummyProtocol1::multiWordWrite(std::vector<uint32_t>& buffer) {
     uint32_t addressInWords = buffer.at(1);
     uint64_t addressInBytes = addressInWords * 4;
     uint32_t nWordsTotal = buffer.at(2);
 
-    if((buffer.size() - 3) < nWordsTotal) {
-      uint32_t nWordsInThisBuffer = buffer.size() - 3;
-      _nWordsLeft = nWordsTotal - nWordsInThisBuffer;
-      _nextAddressInWords = addressInWords + nWordsInThisBuffer;
-
+    if(nWordsTotal > 0) {
       _parent._registerSpace->write(
-          BAR, addressInBytes, reinterpret_cast<int32_t*>(&(buffer.at(3))), 4 * nWordsInThisBuffer);
-      return RebotDummySession::INSIDE_MULTI_WORD_WRITE;
-    }
-    else { // all words in this buffer
-
-      _parent._registerSpace->write(BAR, addressInBytes, reinterpret_cast<int32_t*>(&(buffer.at(3))), 4 * nWordsTotal);
-
-      _parent.sendSingleWord(RebotDummySession::WRITE_SUCCESS_INDICATION);
-      return RebotDummySession::ACCEPT_NEW_COMMAND;
+          BAR, addressInBytes, reinterpret_cast<int32_t*>(&(buffer.at(3))), 4 * nWordsTotal);
     }
-  }
-
-  uint32_t DummyProtocol1::continueMultiWordWrite(std::vector<uint32_t>& buffer) {
-    if(buffer.size() < _nWordsLeft) {
-      uint32_t nWordsInThisBuffer = buffer.size();
-
-      _parent._registerSpace->write(BAR, static_cast<uint64_t>(_nextAddressInWords * 4),
-          reinterpret_cast<int32_t*>(buffer.data()), 4 * nWordsInThisBuffer);
 
-      _nWordsLeft -= nWordsInThisBuffer;
-      _nextAddressInWords += nWordsInThisBuffer;
-
-      return RebotDummySession::INSIDE_MULTI_WORD_WRITE;
-    }
-    else { // all words in this buffer
-
-      _parent._registerSpace->write(BAR, static_cast<uint64_t>(_nextAddressInWords * 4),
-          reinterpret_cast<int32_t*>(buffer.data()), 4 * _nWordsLeft);
-
-      _nextAddressInWords = 0;
-      _nWordsLeft = 0;
-
-      _parent.sendSingleWord(RebotDummySession::WRITE_SUCCESS_INDICATION);
-      return RebotDummySession::ACCEPT_NEW_COMMAND;
-    }
+    _parent.sendSingleWord(RebotDummySession::WRITE_SUCCESS_INDICATION);
   }
 
 } // namespace ChimeraTK
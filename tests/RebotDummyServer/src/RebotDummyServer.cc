@@ -8,6 +8,7 @@
 #include <boost/asio.hpp>
 #include <boost/bind/bind.hpp>
 
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 
@@ -17,7 +18,7 @@ namespace ChimeraTK {
 
   RebotDummySession::RebotDummySession(
       unsigned int protocolVersion, ip::tcp::socket socket, std::shared_ptr<DummyBackend> registerSpace)
-  : _state(ACCEPT_NEW_COMMAND), _heartbeatCount(0), _helloCount(0), _dont_answer(false), _registerSpace(registerSpace),
+  : _heartbeatCount(0), _helloCount(0), _dont_answer(false), _maxRequestsInFlight(0), _registerSpace(registerSpace),
     _protocolVersion(protocolVersion), _currentClientConnection(std::move(socket)) {
     if(protocolVersion == 0) {
       _protocolImplementor.reset(new DummyProtocol0(*this));
@@ -42,12 +43,14 @@ namespace ChimeraTK {
     buffer.reset(new std::vector<uint32_t>(RebotDummySession::BUFFER_SIZE_IN_WORDS));
 
     _currentClientConnection.async_read_some(
-        boost::asio::buffer(*buffer), [this, self, buffer](boost::system::error_code ec, std::size_t) {
+        boost::asio::buffer(*buffer), [this, self, buffer](boost::system::error_code ec, std::size_t bytesReceived) {
           if(ec) {
             _currentClientConnection.close();
           }
           else {
-            processReceivedPackage(*buffer);
+            auto* bytes = reinterpret_cast<uint8_t*>(buffer->data());
+            _receivedData.insert(_receivedData.end(), bytes, bytes + bytesReceived);
+            processReceivedData();
           }
         });
   }
@@ -59,8 +62,8 @@ namespace ChimeraTK {
     }
 
     auto self(shared_from_this());
-    _currentClientConnection.async_write_some(
-        boost::asio::buffer(_dataBuffer), [this, self](boost::system::error_code ec, std::size_t) {
+    boost::asio::async_write(_currentClientConnection, boost::asio::buffer(_dataBuffer),
+        [this, self](boost::system::error_code ec, std::size_t) {
           if(not ec) {
             _dataBuffer.clear();
           }
@@ -74,26 +77,53 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  void RebotDummySession::processReceivedPackage(std::vector<uint32_t>& buffer) {
-    if(_state == INSIDE_MULTI_WORD_WRITE) {
-      _state = _protocolImplementor->continueMultiWordWrite(buffer);
-      doWrite();
-      return;
-    }
+  void RebotDummySession::processReceivedData() {
+    // Process all complete commands and keep the rest for the next packet
+    size_t nWordsReceived = _receivedData.size() / sizeof(uint32_t);
+    size_t offset = 0;
+    uint32_t nCommands = 0;
+    while(nWordsReceived - offset >= COMMAND_HEADER_SIZE_IN_WORDS) {
+      std::vector<uint32_t> header(COMMAND_HEADER_SIZE_IN_WORDS);
+      std::memcpy(header.data(), &_receivedData[offset * sizeof(uint32_t)], header.size() * sizeof(uint32_t));
+
+      size_t commandLength = COMMAND_HEADER_SIZE_IN_WORDS;
+      if(header[0] == MULTI_WORD_WRITE) {
+        commandLength += header[2];
+      }
+      if(nWordsReceived - offset < commandLength) {
+        break;
+      }
 
-    // cause an error condition: just don't answer
-    if(_dont_answer) {
-      doRead();
-      return;
+      std::vector<uint32_t> command(commandLength);
+      std::memcpy(command.data(), &_receivedData[offset * sizeof(uint32_t)], commandLength * sizeof(uint32_t));
+      offset += commandLength;
+
+      // cause an error condition: just don't answer
+      if(_dont_answer) {
+        continue;
+      }
+      processCommand(command);
+      ++nCommands;
     }
+    // The responses to all commands processed here are only sent afterwards, so they were all in flight together.
+    if(nCommands > _maxRequestsInFlight) {
+      _maxRequestsInFlight = nCommands;
+    }
+    _receivedData.erase(_receivedData.begin(), _receivedData.begin() + offset * sizeof(uint32_t));
+
+    doWrite();
+  }
 
+  /********************************************************************************************************************/
+
+  void RebotDummySession::processCommand(std::vector<uint32_t>& buffer) {
     uint32_t requestedAction = buffer.at(0);
     switch(requestedAction) {
       case SINGLE_WORD_WRITE:
         _protocolImplementor->singleWordWrite(buffer);
         break;
       case MULTI_WORD_WRITE:
-        _state = _protocolImplementor->multiWordWrite(buffer);
+        _protocolImplementor->multiWordWrite(buffer);
         break;
       case MULTI_WORD_READ:
         _protocolImplementor->multiWordRead(buffer);
@@ -110,8 +140,6 @@ namespace ChimeraTK {
         std::cout << "Instruction unknown in all protocol versions " << requestedAction << std::endl;
         sendSingleWord(UNKNOWN_INSTRUCTION);
     }
-
-    doWrite();
   }
 
   /********************************************************************************************************************/
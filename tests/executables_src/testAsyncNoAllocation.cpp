@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE testAsyncNoAllocation
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "Device.h"
+#include "DummyBackend.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+/* This test replaces the global operator new and delete, hence it needs its own executable.                         */
+/**********************************************************************************************************************/
+
+// Count the allocations of all threads while countAllocations is set
+static std::atomic<bool> countAllocations{false};
+static std::atomic<size_t> nAllocations{0};
+
+static void* allocate(size_t size, size_t alignment = 0) noexcept {
+  if(countAllocations) {
+    ++nAllocations;
+  }
+  size = (size == 0 ? 1 : size);
+  if(alignment > alignof(std::max_align_t)) {
+    // aligned_alloc requires the size to be a multiple of the alignment
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+  }
+  return std::malloc(size);
+}
+
+static void* allocateOrThrow(size_t size, size_t alignment = 0) {
+  if(void* p = allocate(size, alignment)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+/**********************************************************************************************************************/
+
+void* operator new(size_t size) {
+  return allocateOrThrow(size);
+}
+
+void* operator new[](size_t size) {
+  return allocateOrThrow(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+  return allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+  return allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return allocate(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  return allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+  std::free(p);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDistributionDoesNotAllocate) {
+  Device dummyDevice;
+  dummyDevice.open("(dummy?map=goodMapFile.map)");
+  dummyDevice.activateAsyncRead();
+
+  auto resizeCount = dummyDevice.getScalarRegisterAccessor<uint64_t>("/!6/BUFFER_RESIZE_COUNT");
+  auto asyncAccessor =
+      dummyDevice.getScalarRegisterAccessor<int>("MODULE0/INTERRUPT_TYPE", 0, {AccessMode::wait_for_new_data});
+  auto syncAccessor = dummyDevice.getScalarRegisterAccessor<int>("MODULE0/INTERRUPT_TYPE");
+  auto backend = boost::dynamic_pointer_cast<DummyBackend>(dummyDevice.getBackend());
+  BOOST_REQUIRE(backend);
+  asyncAccessor.read(); // initial value
+
+  // Only the distribution itself is measured, reading and writing the accessors is not part of it.
+  auto distributeAndCheck = [&] {
+    nAllocations = 0;
+    for(int i = 1; i <= 10; ++i) {
+      syncAccessor.setAndWrite(i);
+      countAllocations = true;
+      backend->triggerInterrupt(6);
+      countAllocations = false;
+      BOOST_TEST_REQUIRE(asyncAccessor.readNonBlocking());
+      BOOST_TEST(int(asyncAccessor) == i);
+    }
+    return size_t(nAllocations);
+  };
+
+  // warm-up, e.g. lazily initialised data structures
+  distributeAndCheck();
+
+  // the buffers are circulating between the distribution and the accessor without allocations
+  BOOST_TEST(distributeAndCheck() == 0);
+  resizeCount.read();
+  BOOST_TEST(uint64_t(resizeCount) == 0);
+
+  // Break the shape of the buffer handed out to the application. It is repaired when reading, so the distribution
+  // still does not allocate.
+  asyncAccessor.getImpl()->accessChannel(0).clear();
+  BOOST_TEST(distributeAndCheck() == 0);
+  resizeCount.read();
+  BOOST_TEST(uint64_t(resizeCount) == 1);
+
+  dummyDevice.close();
+}
+
+/**********************************************************************************************************************/
@@ -10,6 +10,7 @@ using namespace boost::unit_test_framework;
 #include "DeviceAccessVersion.h"
 #include "DeviceBackendImpl.h"
 #include "ReadAnyGroup.h"
+#include "TransferGroup.h"
 
 #include <boost/thread.hpp>
 
@@ -540,6 +541,67 @@ BOOST_AUTO_TEST_CASE(testReadAnyWithPoll) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testReadAnyWithMergedPoll) {
+  std::cout << "testReadAnyWithMergedPoll" << std::endl;
+
+  Device device;
+  device.open(cdd);
+  auto backend = boost::dynamic_pointer_cast<AsyncTestDummy>(BackendFactory::getInstance().createBackend(cdd));
+  BOOST_CHECK(backend != nullptr);
+
+  auto a1 = device.getScalarRegisterAccessor<int32_t>("a1", 0, {AccessMode::wait_for_new_data});
+  auto a3 = device.getScalarRegisterAccessor<int32_t>("a3");
+  auto a4 = device.getScalarRegisterAccessor<int32_t>("a4");
+  auto a5 = device.getScalarRegisterAccessor<int32_t>("a5");
+
+  // a5 is already in a TransferGroup, so it cannot be merged
+  TransferGroup userGroup;
+  userGroup.addAccessor(a5);
+
+  backend->registers["/a1"] = 42;
+  backend->registers["/a3"] = 120;
+  backend->registers["/a4"] = 345;
+  backend->registers["/a5"] = 678;
+
+  ReadAnyGroup group;
+  group.add(a1);
+  group.add(a3);
+  group.add(a4);
+  group.add(a5);
+  group.finalise(true);
+
+  backend->notificationQueue["/a1"].push();
+  auto id = group.readAny();
+  BOOST_CHECK(id == a1.getId());
+  BOOST_CHECK(a1 == 42);
+  BOOST_CHECK(a3 == 120);
+  BOOST_CHECK(a4 == 345);
+  BOOST_CHECK(a5 == 678);
+
+  backend->registers["/a3"] = 121;
+  backend->registers["/a5"] = 679;
+  group.processPolled();
+  BOOST_CHECK(a3 == 121);
+  BOOST_CHECK(a5 == 679);
+
+  // the merged elements are now part of a TransferGroup
+  BOOST_CHECK_THROW(a3.read(), ChimeraTK::logic_error);
+
+  // the membership stays after the ReadAnyGroup is gone
+  group = ReadAnyGroup();
+  BOOST_CHECK_THROW(a3.read(), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(a4.read(), ChimeraTK::logic_error);
+
+  // the element excluded from merging is unaffected
+  backend->registers["/a5"] = 680;
+  userGroup.read();
+  BOOST_CHECK(a5 == 680);
+
+  device.close();
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(testWaitAny) {
   std::cout << "testWaitAny" << std::endl;
 
@@ -646,6 +708,180 @@ BOOST_AUTO_TEST_CASE(testWaitAny) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testReadAnyBatch) {
+  std::cout << "testReadAnyBatch" << std::endl;
+
+  Device device;
+  device.open(cdd);
+  auto backend = boost::dynamic_pointer_cast<AsyncTestDummy>(BackendFactory::getInstance().createBackend(cdd));
+  BOOST_CHECK(backend != nullptr);
+
+  auto a1 = device.getScalarRegisterAccessor<int32_t>("a1", 0, {AccessMode::wait_for_new_data});
+  auto a2 = device.getScalarRegisterAccessor<int32_t>("a2", 0, {AccessMode::wait_for_new_data});
+  auto a3 = device.getScalarRegisterAccessor<int32_t>("a3");
+  auto a3impl = boost::dynamic_pointer_cast<AsyncTestDummy::Accessor<int32_t>>(a3.getHighLevelImplElement());
+  BOOST_REQUIRE(a3impl);
+
+  backend->registers["/a1"] = 42;
+  backend->registers["/a2"] = 123;
+  backend->registers["/a3"] = 120;
+
+  ReadAnyGroup group{a1, a2, a3};
+
+  // all available updates are processed at once, the poll-type element is updated only once
+  backend->notificationQueue["/a1"].push();
+  backend->notificationQueue["/a2"].push();
+  backend->notificationQueue["/a1"].push();
+  size_t nPostReadBefore = a3impl->nPostReadCalled;
+  auto ids = group.readAnyBatch();
+  BOOST_TEST(ids.size() == 3);
+  BOOST_CHECK(ids[0] == a1.getId());
+  BOOST_CHECK(ids[1] == a2.getId());
+  BOOST_CHECK(ids[2] == a1.getId());
+  BOOST_CHECK(a1 == 42);
+  BOOST_CHECK(a2 == 123);
+  BOOST_CHECK(a3 == 120);
+  BOOST_TEST(a3impl->nPostReadCalled == nPostReadBefore + 1);
+
+  // the number of updates can be limited, the remaining updates are processed with the next call
+  backend->registers["/a2"] = 124;
+  backend->notificationQueue["/a2"].push();
+  backend->notificationQueue["/a1"].push();
+  ids = group.readAnyBatch(1);
+  BOOST_TEST(ids.size() == 1);
+  BOOST_CHECK(ids[0] == a2.getId());
+  BOOST_CHECK(a2 == 124);
+  ids = group.readAnyBatch(1);
+  BOOST_TEST(ids.size() == 1);
+  BOOST_CHECK(ids[0] == a1.getId());
+
+  // the call blocks until at least one update is available
+  std::atomic<bool> flag{false};
+  std::thread thread([&] {
+    ids = group.readAnyBatch();
+    flag = true;
+  });
+  usleep(100000);
+  BOOST_CHECK(flag == false);
+  backend->notificationQueue["/a2"].push();
+  thread.join();
+  BOOST_TEST(ids.size() == 1);
+  BOOST_CHECK(ids[0] == a2.getId());
+
+  device.close();
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testWaitAnyBatch) {
+  std::cout << "testWaitAnyBatch" << std::endl;
+
+  Device device;
+  device.open(cdd);
+  auto backend = boost::dynamic_pointer_cast<AsyncTestDummy>(BackendFactory::getInstance().createBackend(cdd));
+  BOOST_CHECK(backend != nullptr);
+
+  auto a1 = device.getScalarRegisterAccessor<int32_t>("a1", 0, {AccessMode::wait_for_new_data});
+  auto a2 = device.getScalarRegisterAccessor<int32_t>("a2", 0, {AccessMode::wait_for_new_data});
+  auto a1impl = boost::dynamic_pointer_cast<AsyncTestDummy::Accessor<int32_t>>(a1.getHighLevelImplElement());
+  BOOST_REQUIRE(a1impl);
+
+  backend->registers["/a1"] = 42;
+  backend->registers["/a2"] = 123;
+
+  ReadAnyGroup group{a1, a2};
+
+  backend->notificationQueue["/a1"].push();
+  backend->notificationQueue["/a2"].push();
+  backend->notificationQueue["/a1"].push();
+  auto ids = group.waitAnyBatch();
+  BOOST_TEST(ids.size() == 3);
+  BOOST_CHECK(ids[0] == a1.getId());
+  BOOST_CHECK(ids[1] == a2.getId());
+  BOOST_CHECK(ids[2] == a1.getId());
+
+  // nothing has been processed yet
+  BOOST_CHECK(a1 == 0);
+  BOOST_CHECK(a2 == 0);
+
+  size_t nPostReadBefore = a1impl->nPostReadCalled;
+  for(size_t i = 0; i < ids.size(); ++i) {
+    BOOST_CHECK(group.acceptBatched());
+  }
+  BOOST_CHECK(a1 == 42);
+  BOOST_CHECK(a2 == 123);
+  BOOST_TEST(a1impl->nPostReadCalled == nPostReadBefore + 2);
+  BOOST_CHECK_THROW(group.acceptBatched(), ChimeraTK::logic_error);
+
+  // limit the number of notifications
+  backend->notificationQueue["/a2"].push();
+  backend->notificationQueue["/a1"].push();
+  ids = group.waitAnyBatch(1);
+  BOOST_TEST(ids.size() == 1);
+  BOOST_CHECK(ids[0] == a2.getId());
+  BOOST_CHECK(group.acceptBatched());
+  ids = group.waitAnyBatch(1);
+  BOOST_TEST(ids.size() == 1);
+  BOOST_CHECK(ids[0] == a1.getId());
+
+  // notifications which are not accepted are returned again
+  ids = group.waitAnyBatch();
+  BOOST_TEST(ids.size() == 1);
+  BOOST_CHECK(ids[0] == a1.getId());
+  BOOST_CHECK(group.readAny() == a1.getId());
+
+  device.close();
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testWaitAnyBatchExceptions) {
+  std::cout << "testWaitAnyBatchExceptions" << std::endl;
+
+  Device device;
+  device.open(cdd);
+  auto backend = boost::dynamic_pointer_cast<AsyncTestDummy>(BackendFactory::getInstance().createBackend(cdd));
+  BOOST_CHECK(backend != nullptr);
+
+  auto a1 = device.getScalarRegisterAccessor<int32_t>("a1", 0, {AccessMode::wait_for_new_data});
+  auto a2 = device.getScalarRegisterAccessor<int32_t>("a2", 0, {AccessMode::wait_for_new_data});
+  auto a3 = device.getScalarRegisterAccessor<int32_t>("a3", 0, {AccessMode::wait_for_new_data});
+  backend->registers["/a1"] = 42;
+
+  ReadAnyGroup group{a1, a2, a3};
+
+  // a device fault puts an exception into all accessors of the device
+  backend->notificationQueue["/a1"].push();
+  for(const auto* name : {"/a1", "/a2", "/a3"}) {
+    backend->notificationQueue[name].push_exception(
+        std::make_exception_ptr(ChimeraTK::runtime_error("Test exception")));
+  }
+  auto ids = group.waitAnyBatch();
+  BOOST_TEST(ids.size() == 4);
+
+  // each exception is thrown by the acceptBatched() call for the according notification, the others are kept
+  BOOST_CHECK(group.acceptBatched());
+  BOOST_CHECK(a1 == 42);
+  BOOST_CHECK_THROW(group.acceptBatched(), ChimeraTK::runtime_error);
+
+  // notifications left from the batch are not lost, they are returned first by the next call
+  ids = group.waitAnyBatch();
+  BOOST_TEST(ids.size() == 2);
+  BOOST_CHECK(ids[0] == a2.getId());
+  BOOST_CHECK(ids[1] == a3.getId());
+  BOOST_CHECK_THROW(group.acceptBatched(), ChimeraTK::runtime_error);
+  BOOST_CHECK_THROW(group.readAny(), ChimeraTK::runtime_error);
+  BOOST_CHECK_THROW(group.acceptBatched(), ChimeraTK::logic_error);
+
+  // the group continues to work normally
+  backend->notificationQueue["/a1"].push();
+  BOOST_CHECK(group.readAny() == a1.getId());
+
+  device.close();
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(testReadAnyException) {
   std::cout << "testReadAnyException" << std::endl;
 
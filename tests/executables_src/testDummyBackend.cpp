@@ -14,6 +14,10 @@
 #include <boost/function.hpp>
 #include <boost/lambda/lambda.hpp>
 
+#include <chrono>
+#include <future>
+#include <numeric>
+
 // FIXME Remove
 #include <regex>
 
@@ -57,8 +61,8 @@ class TestableDummyBackend : public DummyBackend {
   using DummyBackend::setWriteCallbackFunction;
   using DummyBackend::writeRegisterWithoutCallback;
   using DummyBackend::isWriteRangeOverlap;
-  using DummyBackend::_readOnlyAddresses;
-  using DummyBackend::_writeCallbackFunctions;
+  using DummyBackend::_bars;
+  using DummyBackend::findCallbackFunctionsForAddressRange;
 
   static boost::shared_ptr<DeviceBackend> createInstance(std::string, std::map<std::string, std::string> parameters) {
     return boost::shared_ptr<DeviceBackend>(new TestableDummyBackend(parameters["map"]));
@@ -529,6 +533,190 @@ BOOST_AUTO_TEST_CASE(testDummyInterrupt) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testDummyInterruptDistributionThreads) {
+  BOOST_CHECK_THROW(
+      FactoryInstance.createBackend("(dummy?map=goodMapFile.map&distributionThreads=many)"), ChimeraTK::logic_error);
+
+  ChimeraTK::Device dummyDevice;
+  dummyDevice.open("(dummy?map=goodMapFile.map&distributionThreads=3)");
+  dummyDevice.activateAsyncRead();
+
+  // many subscribers to the same interrupt are served by the worker threads
+  std::vector<ScalarRegisterAccessor<int>> asyncAccessors;
+  for(size_t i = 0; i < 50; ++i) {
+    asyncAccessors.push_back(
+        dummyDevice.getScalarRegisterAccessor<int>("MODULE0/INTERRUPT_TYPE", 0, {AccessMode::wait_for_new_data}));
+    asyncAccessors.back().read(); // initial value
+  }
+  auto interruptAccessor = dummyDevice.getVoidRegisterAccessor("/DUMMY_INTERRUPT_6");
+  auto syncAccessor = dummyDevice.getScalarRegisterAccessor<int>("MODULE0/INTERRUPT_TYPE");
+
+  for(int value = 1; value <= 3; ++value) {
+    syncAccessor.setAndWrite(value);
+    interruptAccessor.write();
+    VersionNumber version{nullptr};
+    for(auto& accessor : asyncAccessors) {
+      BOOST_REQUIRE(accessor.readNonBlocking());
+      BOOST_CHECK_EQUAL(int(accessor), value);
+      if(version == VersionNumber{nullptr}) {
+        version = accessor.getVersionNumber();
+      }
+      BOOST_CHECK(accessor.getVersionNumber() == version);
+      BOOST_CHECK(!accessor.readNonBlocking());
+    }
+  }
+
+  // subscribers can go away during operation
+  asyncAccessors.resize(10);
+  syncAccessor.setAndWrite(42);
+  interruptAccessor.write();
+  for(auto& accessor : asyncAccessors) {
+    BOOST_REQUIRE(accessor.readNonBlocking());
+    BOOST_CHECK_EQUAL(int(accessor), 42);
+  }
+
+  dummyDevice.close();
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDummyInterruptStatistics) {
+  BOOST_CHECK_THROW(
+      FactoryInstance.createBackend("(dummy?map=goodMapFile.map&maxDistributionRate=fast)"), ChimeraTK::logic_error);
+
+  ChimeraTK::Device dummyDevice;
+  dummyDevice.open("(dummy?map=goodMapFile.map&maxDistributionRate=50)");
+  dummyDevice.activateAsyncRead();
+
+  auto interruptCount = dummyDevice.getScalarRegisterAccessor<uint64_t>("/!6/INTERRUPT_COUNT");
+  auto missedInterruptCount = dummyDevice.getScalarRegisterAccessor<uint64_t>("/!6/MISSED_INTERRUPT_COUNT");
+  auto latency = dummyDevice.getScalarRegisterAccessor<uint64_t>("/!6/DISTRIBUTION_LATENCY_NS");
+  BOOST_CHECK(interruptCount.isReadOnly());
+  BOOST_CHECK_THROW(interruptCount.write(), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(dummyDevice.getScalarRegisterAccessor<uint64_t>("/!6/NO_SUCH_STATISTICS"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(
+      dummyDevice.getScalarRegisterAccessor<uint64_t>("/!6/INTERRUPT_COUNT", 0, {AccessMode::wait_for_new_data}),
+      ChimeraTK::logic_error);
+
+  // no subscription yet
+  interruptCount.read();
+  BOOST_CHECK_EQUAL(uint64_t(interruptCount), 0);
+
+  auto asyncAccessor =
+      dummyDevice.getScalarRegisterAccessor<int>("MODULE0/INTERRUPT_TYPE", 0, {AccessMode::wait_for_new_data});
+  asyncAccessor.read(); // initial value
+  auto interruptAccessor = dummyDevice.getVoidRegisterAccessor("/DUMMY_INTERRUPT_6");
+
+  // with at most 50 distributions per second, the distributions are at least 20 ms apart
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < 5; ++i) {
+    interruptAccessor.write();
+    BOOST_CHECK(asyncAccessor.readNonBlocking());
+  }
+  BOOST_CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(79));
+
+  interruptCount.read();
+  BOOST_CHECK_EQUAL(uint64_t(interruptCount), 5);
+  missedInterruptCount.read();
+  BOOST_CHECK_EQUAL(uint64_t(missedInterruptCount), 0);
+  latency.read();
+  BOOST_CHECK(uint64_t(latency) > 0);
+
+  // interrupts coalesced by the driver count as interrupts and as missed interrupts
+  auto backend = boost::dynamic_pointer_cast<DummyBackend>(dummyDevice.getBackend());
+  backend->reportMissedInterrupts(6, 3);
+  interruptAccessor.write();
+  BOOST_CHECK(asyncAccessor.readNonBlocking());
+  interruptCount.read();
+  BOOST_CHECK_EQUAL(uint64_t(interruptCount), 9);
+  missedInterruptCount.read();
+  BOOST_CHECK_EQUAL(uint64_t(missedInterruptCount), 3);
+
+  dummyDevice.close();
+  BOOST_CHECK_THROW(interruptCount.read(), ChimeraTK::logic_error);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDummyQueuePolicy) {
+  BOOST_CHECK_THROW(FactoryInstance.createBackend("(dummy?map=goodMapFile.map&asyncQueueOverflow=dropOldest)"),
+      ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(
+      FactoryInstance.createBackend("(dummy?map=goodMapFile.map&asyncQueueLength=0)"), ChimeraTK::logic_error);
+
+  ChimeraTK::Device dummyDevice;
+  dummyDevice.open("(dummy?map=goodMapFile.map&asyncQueueLength=1&asyncQueueOverflow=dropNewest)");
+  dummyDevice.activateAsyncRead();
+
+  auto overflowCount = dummyDevice.getScalarRegisterAccessor<uint64_t>("/!6/QUEUE_OVERFLOW_COUNT");
+  auto asyncAccessor =
+      dummyDevice.getScalarRegisterAccessor<int>("MODULE0/INTERRUPT_TYPE", 0, {AccessMode::wait_for_new_data});
+  auto syncAccessor = dummyDevice.getScalarRegisterAccessor<int>("MODULE0/INTERRUPT_TYPE");
+  auto interruptAccessor = dummyDevice.getVoidRegisterAccessor("/DUMMY_INTERRUPT_6");
+  asyncAccessor.read(); // initial value
+
+  // the queue holds only one value, the newer ones are dropped
+  for(int i = 1; i <= 3; ++i) {
+    syncAccessor.setAndWrite(i);
+    interruptAccessor.write();
+  }
+  BOOST_CHECK(asyncAccessor.readNonBlocking());
+  BOOST_CHECK_EQUAL(int(asyncAccessor), 1);
+  BOOST_CHECK(!asyncAccessor.readNonBlocking());
+
+  overflowCount.read();
+  BOOST_CHECK_EQUAL(uint64_t(overflowCount), 2);
+
+  dummyDevice.close();
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDummyBlockProducer) {
+  auto backend = boost::dynamic_pointer_cast<DummyBackend>(FactoryInstance.createBackend(
+      "(dummy?map=goodMapFile.map&asyncQueueLength=1&asyncQueueOverflow=blockProducer)"));
+  BOOST_REQUIRE(backend);
+  backend->open();
+  backend->activateAsyncRead();
+
+  auto asyncAccessor =
+      backend->getRegisterAccessor<int>("MODULE0/INTERRUPT_TYPE", 1, 0, {AccessMode::wait_for_new_data});
+  asyncAccessor->read(); // initial value
+
+  // Fill the queue, so the next distribution has to wait until the consumer has read a value.
+  auto startBlockedDistribution = [&] {
+    backend->triggerInterrupt(6);
+    auto distribution = std::async(std::launch::async, [&] { backend->triggerInterrupt(6); });
+    BOOST_CHECK(distribution.wait_for(std::chrono::milliseconds(200)) == std::future_status::timeout);
+    return distribution;
+  };
+
+  auto blocked = startBlockedDistribution();
+  asyncAccessor->read();
+  BOOST_CHECK(blocked.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+  BOOST_CHECK(asyncAccessor->readNonBlocking());
+
+  // The domain lock is not held while waiting, so accessors can be (un)subscribed and an exception ends the wait.
+  blocked = startBlockedDistribution();
+  auto otherAccessor =
+      backend->getRegisterAccessor<int>("MODULE0/INTERRUPT_TYPE", 1, 0, {AccessMode::wait_for_new_data});
+  otherAccessor.reset();
+  backend->setException("Test exception");
+  BOOST_CHECK(blocked.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+  asyncAccessor.reset();
+
+  // closing the backend ends the wait as well
+  backend->open();
+  backend->activateAsyncRead();
+  asyncAccessor = backend->getRegisterAccessor<int>("MODULE0/INTERRUPT_TYPE", 1, 0, {AccessMode::wait_for_new_data});
+  asyncAccessor->read(); // initial value
+  blocked = startBlockedDistribution();
+  backend->close();
+  BOOST_CHECK(blocked.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(testAddressRange) {
   TestableDummyBackend::AddressRange range24_8_0(0, 24, 8);
 
@@ -570,12 +758,54 @@ BOOST_AUTO_TEST_CASE(testIsWriteRangeOverlap) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testBarLookup) {
+  TestableDummyBackend* dummyBackend = f.getBackendInstance();
+
+  // bulk access to a whole bar
+  std::vector<int32_t> data(dummyBackend->_barContents[2].size());
+  std::iota(data.begin(), data.end(), 100);
+  dummyBackend->write(static_cast<uint64_t>(2), 0, data.data(), data.size() * sizeof(int32_t));
+  std::vector<int32_t> readback(data.size(), -1);
+  dummyBackend->read(static_cast<uint64_t>(2), 0, readback.data(), readback.size() * sizeof(int32_t));
+  BOOST_CHECK(readback == data);
+
+  // access beyond the end of a bar and to unknown bars is detected
+  BOOST_CHECK_THROW(dummyBackend->read(static_cast<uint64_t>(2), 4, readback.data(), readback.size() * sizeof(int32_t)),
+      ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(dummyBackend->write(static_cast<uint64_t>(2), 4, data.data(), data.size() * sizeof(int32_t)),
+      ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(dummyBackend->read(static_cast<uint64_t>(5), 0, readback.data(), 4), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(dummyBackend->read(static_cast<uint64_t>(0x100000000), 0, readback.data(), 4),
+      ChimeraTK::logic_error);
+
+  // callback lookup in a bar with many overlapping callbacks
+  // (the callbacks stay registered in the backend, so the counters must outlive this test)
+  auto counters = std::make_shared<std::vector<int>>(100, 0);
+  for(size_t i = 0; i < counters->size(); ++i) {
+    // register in reverse order, each callback covers the words [index, 2*index]
+    size_t index = counters->size() - 1 - i;
+    dummyBackend->setWriteCallbackFunction(
+        TestableDummyBackend::AddressRange(2, 4 * index, 4 * (index + 1)), [counters, index] { ++(*counters)[index]; });
+  }
+  int32_t word = 42;
+  dummyBackend->write(static_cast<uint64_t>(2), 4 * 60, &word, 4);
+  for(size_t i = 0; i < counters->size(); ++i) {
+    BOOST_CHECK_EQUAL((*counters)[i], (i <= 60 && 2 * i >= 60) ? 1 : 0);
+  }
+  auto unrelatedRange = TestableDummyBackend::AddressRange(2, 4 * 200, 4);
+  BOOST_CHECK(dummyBackend->findCallbackFunctionsForAddressRange(unrelatedRange).empty());
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(testFinalClosing) {
   // all features have to be enabled before closing
   TestableDummyBackend* dummyBackend = f.getBackendInstance();
   BOOST_CHECK(dummyBackend->_barContents.size() != 0);
-  BOOST_CHECK(dummyBackend->_readOnlyAddresses.size() != 0);
-  BOOST_CHECK(dummyBackend->_writeCallbackFunctions.size() != 0);
+  BOOST_CHECK(std::any_of(dummyBackend->_bars.begin(), dummyBackend->_bars.end(),
+      [](auto& bar) { return bar.second.nReadOnlyWords != 0; }));
+  BOOST_CHECK(std::any_of(dummyBackend->_bars.begin(), dummyBackend->_bars.end(),
+      [](auto& bar) { return !bar.second.writeCallbacks.empty(); }));
 
   dummyBackend->close();
 }
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE InterruptEventFileTest
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "async/InterruptEventFile.h"
+#include "BackendFactory.h"
+
+#include <sys/stat.h>
+
+#include <boost/make_shared.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+// A FIFO is used as stand-in for the event file of a driver. The writing end is opened first (read-write, so it does
+// not block), then the InterruptEventFile can open the reading end.
+struct Fixture {
+  Fixture() {
+    std::filesystem::remove(path);
+    BOOST_REQUIRE(::mkfifo(path.c_str(), 0600) == 0);
+    writer = ::open(path.c_str(), O_RDWR);
+    BOOST_REQUIRE(writer >= 0);
+    backend->open();
+  }
+
+  ~Fixture() {
+    if(writer >= 0) {
+      ::close(writer);
+    }
+    std::filesystem::remove(path);
+  }
+
+  void signal(uint32_t nInterrupts) const {
+    BOOST_REQUIRE(::write(writer, &nInterrupts, sizeof(nInterrupts)) == sizeof(nInterrupts));
+  }
+
+  template<typename CONDITION>
+  static bool waitFor(CONDITION condition) {
+    for(size_t i = 0; i < 500; ++i) {
+      if(condition()) {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+  }
+
+  std::filesystem::path path{
+      std::filesystem::temp_directory_path() / ("testInterruptEventFile-" + std::to_string(getpid()))};
+  int writer{-1};
+  boost::shared_ptr<DeviceBackend> backend{BackendFactory::getInstance().createBackend("(dummy?map=goodMapFile.map)")};
+  boost::shared_ptr<async::DomainImpl<std::nullptr_t>> domain{
+      boost::make_shared<async::DomainImpl<std::nullptr_t>>(backend, 6)};
+};
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testDistribution, Fixture) {
+  async::InterruptEventFile eventFile(backend.get(), path.string(), domain);
+  auto started = std::promise<void>();
+  auto startedFuture = started.get_future();
+  eventFile.startThread(std::move(started));
+  startedFuture.wait();
+
+  // one distribution per event
+  signal(1);
+  BOOST_TEST(waitFor([&] { return domain->getInterruptCount() == 1; }));
+  BOOST_TEST(eventFile.getMissedInterruptCount() == 0);
+
+  // surplus interrupts of one event are counted as missed
+  signal(3);
+  BOOST_TEST(waitFor([&] { return domain->getInterruptCount() == 4; }));
+  BOOST_TEST(eventFile.getMissedInterruptCount() == 2);
+
+  // starting the thread again does nothing but fulfilling the promise
+  auto startedAgain = std::promise<void>();
+  auto startedAgainFuture = startedAgain.get_future();
+  eventFile.startThread(std::move(startedAgain));
+  BOOST_TEST((startedAgainFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready));
+
+  BOOST_TEST(backend->isFunctional());
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testErrors, Fixture) {
+  BOOST_CHECK_THROW(async::InterruptEventFile(backend.get(), path.string() + "-missing", domain), runtime_error);
+
+  {
+    async::InterruptEventFile eventFile(backend.get(), path.string(), domain);
+    eventFile.startThread({});
+
+    // closing the writing end is seen as I/O error (end of file)
+    ::close(writer);
+    writer = -1;
+    BOOST_TEST(waitFor([&] { return !backend->isFunctional(); }));
+  }
+
+  // removing the file is detected by the periodic health check
+  backend->open();
+  writer = ::open(path.c_str(), O_RDWR);
+  BOOST_REQUIRE(writer >= 0);
+  async::InterruptEventFile eventFile(backend.get(), path.string(), domain);
+  eventFile.startThread({});
+  BOOST_TEST(backend->isFunctional());
+  std::filesystem::remove(path);
+  BOOST_TEST(waitFor([&] { return !backend->isFunctional(); }));
+}
+
+/**********************************************************************************************************************/
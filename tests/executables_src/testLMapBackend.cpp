@@ -885,6 +885,57 @@ BOOST_AUTO_TEST_CASE(testRegisterAccessorForBit) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testBitReadSnapshot) {
+  std::string targetCdd = "(ExceptionDummy:bitSnapshot?map=mtcadummy.map)";
+  auto target = boost::dynamic_pointer_cast<ExceptionDummy>(BackendFactory::getInstance().createBackend(targetCdd));
+  DummyRegisterAccessor<uint32_t> status(target.get(), "BOARD", "WORD_STATUS");
+
+  for(bool snapshotsEnabled : {false, true}) {
+    std::string cdd = "(logicalNameMap?map=bitSnapshot.xlmap&target=" + targetCdd;
+    cdd += snapshotsEnabled ? "&maxBitReadAge=3600000)" : ")";
+    Device device(cdd);
+    device.open();
+
+    auto bit0 = device.getScalarRegisterAccessor<int>("Bit0");
+    auto bit1 = device.getScalarRegisterAccessor<int>("Bit1");
+
+    status = 0;
+    bit0.read();
+    BOOST_TEST(int(bit0) == 0);
+
+    // with snapshots, bit1 reuses the read of bit0
+    status = 3;
+    bit1.read();
+    BOOST_TEST(int(bit1) == (snapshotsEnabled ? 0 : 1));
+
+    // each accessor uses a snapshot only once, so reading again always reads the target
+    bit1.read();
+    BOOST_TEST(int(bit1) == 1);
+    bit0.read();
+    BOOST_TEST(int(bit0) == 1);
+
+    // writing invalidates the snapshot
+    bit0 = 0;
+    bit0.write();
+    BOOST_TEST(status == 2);
+    status = 1;
+    bit1.read();
+    BOOST_TEST(int(bit1) == 0);
+
+    // the snapshot is not used after the shared target accessor has been recreated, as its buffer has never been read
+    status = 2;
+    bit0.replace(boost::shared_ptr<NDRegisterAccessor<int>>());
+    bit1.replace(boost::shared_ptr<NDRegisterAccessor<int>>());
+    bit1.replace(device.getScalarRegisterAccessor<int>("Bit1"));
+    bit1.read();
+    BOOST_TEST(int(bit1) == 1);
+
+    device.close();
+  }
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(testOther) {
   BackendFactory::getInstance().setDMapFilePath("logicalnamemap.dmap");
   ChimeraTK::Device device;
@@ -8,10 +8,14 @@
 using namespace boost::unit_test_framework;
 
 #include "Exception.h"
+#include "MapFileCache.h"
 #include "MapFileParser.h"
 #include "NumericAddressedRegisterCatalogue.h"
 
+#include <filesystem>
+#include <fstream>
 #include <sstream>
+#include <tuple>
 
 using namespace ChimeraTK;
 using namespace boost::unit_test_framework;
@@ -513,4 +517,101 @@ BOOST_AUTO_TEST_CASE(testMapFileNewStyleMuxed) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testMapFileCache) {
+  const std::string cacheDirectory = "testMapFileCache.dir";
+  std::filesystem::remove_all(cacheDirectory);
+  MapFileParser::setCacheDirectory(cacheDirectory);
+
+  for(const std::string fileName : {"interruptMapFile.map", "simpleJsonFile.jmap"}) {
+    MapFileParser::setCacheDirectory("");
+    auto [regcatParsed, mdcatParsed] = MapFileParser::parse(fileName);
+    MapFileParser::setCacheDirectory(cacheDirectory);
+
+    // first call fills the cache, second call uses it
+    std::ignore = MapFileParser::parse(fileName);
+    size_t nCacheFiles = 0;
+    for(const auto& entry : std::filesystem::directory_iterator(cacheDirectory)) {
+      if(entry.path().filename().string().starts_with(fileName)) {
+        ++nCacheFiles;
+      }
+    }
+    BOOST_TEST(nCacheFiles == 1);
+    auto [regcat, mdcat] = MapFileParser::parse(fileName);
+
+    BOOST_TEST(regcat.getNumberOfRegisters() == regcatParsed.getNumberOfRegisters());
+    auto it = regcat.begin();
+    for(const auto& expected : regcatParsed) {
+      BOOST_REQUIRE(it != regcat.end());
+      BOOST_CHECK(*it == expected);
+      BOOST_CHECK(it->getDataDescriptor() == expected.getDataDescriptor());
+      BOOST_CHECK(it->doubleBuffer.has_value() == expected.doubleBuffer.has_value());
+      if(it->doubleBuffer && expected.doubleBuffer) {
+        BOOST_CHECK(it->doubleBuffer->address == expected.doubleBuffer->address);
+        BOOST_CHECK(it->doubleBuffer->enableRegisterPath == expected.doubleBuffer->enableRegisterPath);
+        BOOST_CHECK(it->doubleBuffer->inactiveBufferRegisterPath == expected.doubleBuffer->inactiveBufferRegisterPath);
+        BOOST_CHECK(it->doubleBuffer->index == expected.doubleBuffer->index);
+      }
+      ++it;
+    }
+    BOOST_TEST(regcat.getListOfInterrupts() == regcatParsed.getListOfInterrupts());
+    BOOST_TEST(mdcat.getNumberOfMetadata() == mdcatParsed.getNumberOfMetadata());
+    for(auto md = mdcatParsed.cbegin(); md != mdcatParsed.cend(); ++md) {
+      BOOST_TEST(mdcat.getMetadata(md->first) == md->second);
+    }
+  }
+
+  // invalid cache files are ignored
+  for(const auto& entry : std::filesystem::directory_iterator(cacheDirectory)) {
+    std::ofstream(entry.path(), std::ios::trunc) << "garbage";
+  }
+  auto [regcat, mdcat] = MapFileParser::parse("interruptMapFile.map");
+  BOOST_TEST(regcat.hasRegister("APP0/INTERRUPT_VOID_1"));
+  BOOST_TEST(regcat.hasRegister("!0"));
+
+  MapFileParser::setCacheDirectory("");
+  std::filesystem::remove_all(cacheDirectory);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testMapFileCacheValidation) {
+  const std::string mapFileContent = "MY.REG 1 0 4 0 32 0 1 RW";
+  detail::MapFileCache::Content content;
+  content.first.addRegister(NumericAddressedRegisterInfo("MY.REG", 1, 0, 4, 0, 32, 0, true));
+
+  // the key depends on the library version, not only on the map file content
+  auto key = detail::MapFileCache::getCacheKey(mapFileContent);
+  BOOST_TEST(key != detail::MapFileCache::hash(mapFileContent));
+
+  auto data = detail::MapFileCache::serialise(content, key);
+  BOOST_TEST(detail::MapFileCache::deserialise(data, key).has_value());
+  BOOST_TEST(!detail::MapFileCache::deserialise(data, detail::MapFileCache::hash(mapFileContent)).has_value());
+  BOOST_TEST(!detail::MapFileCache::deserialise(data.substr(0, data.size() - 1), key).has_value());
+
+  // Locate the fields following the register name: bar (8 bytes), address (8), nElements (4), elementPitchBits (4),
+  // access (1), hidden (1), number of interrupt IDs (4), has double buffer (1), number of channels (4), bitOffset (4),
+  // dataType (1), ...
+  auto namePos = data.find("/MY/REG");
+  BOOST_REQUIRE(namePos != std::string::npos);
+  auto accessPos = namePos + 7 + 8 + 8 + 4 + 4;
+  auto hiddenPos = accessPos + 1;
+  auto doubleBufferPos = hiddenPos + 1 + 4;
+  auto dataTypePos = doubleBufferPos + 1 + 4 + 4;
+  BOOST_REQUIRE(data[accessPos] == char(NumericAddressedRegisterInfo::Access::READ_WRITE));
+
+  // any invalid value is a cache miss
+  for(auto pos : {accessPos, hiddenPos, doubleBufferPos, dataTypePos}) {
+    auto corrupted = data;
+    corrupted[pos] = char(0x7F);
+    BOOST_TEST(!detail::MapFileCache::deserialise(corrupted, key).has_value(), "corrupted byte at " << pos);
+  }
+
+  // interrupt access without interrupt ID
+  auto corrupted = data;
+  corrupted[accessPos] = char(NumericAddressedRegisterInfo::Access::INTERRUPT);
+  BOOST_TEST(!detail::MapFileCache::deserialise(corrupted, key).has_value());
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_SUITE_END()
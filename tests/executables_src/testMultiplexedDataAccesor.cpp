@@ -8,6 +8,8 @@
 #include "MapFileParser.h"
 #include "TwoDRegisterAccessor.h"
 
+#include <cstring>
+#include <functional>
 #include <iostream>
 #include <sstream>
 
@@ -462,4 +464,72 @@ BOOST_DATA_TEST_CASE(testAreaOfInterestLength, boost::unit_test::data::make({ARE
   }
 }
 
+/**********************************************************************************************************************/
+
+// Check the block-wise (de)multiplexing of homogeneous areas against a byte-wise computed reference. The areas are
+// larger than a single block and contain a partial block at the end.
+template<typename RawType>
+void checkHomogeneousArea(Device& device, const std::string& name, size_t nChannels, size_t nSamples,
+    const std::function<double(RawType)>& toCooked) {
+  BOOST_TEST_CONTEXT(name) {
+    auto muxed = device.getTwoDRegisterAccessor<double>("ADC/" + name);
+    auto raw = device.getOneDRegisterAccessor<int32_t>("ADC/" + name + ".MULTIPLEXED_RAW", 0, 0, {AccessMode::raw});
+    BOOST_TEST(muxed.getNChannels() == nChannels);
+    BOOST_TEST(muxed.getNElementsPerChannel() == nSamples);
+
+    auto rawValue = [](size_t sample, size_t channel) {
+      return static_cast<RawType>(sample * 2654435761U + channel * 40503U + 12345U);
+    };
+
+    // fill the raw buffer with a pattern and read it de-multiplexed
+    std::vector<RawType> rawData(nChannels * nSamples);
+    for(size_t sample = 0; sample < nSamples; ++sample) {
+      for(size_t channel = 0; channel < nChannels; ++channel) {
+        rawData[sample * nChannels + channel] = rawValue(sample, channel);
+      }
+    }
+    std::memcpy(raw.data(), rawData.data(), rawData.size() * sizeof(RawType));
+    raw.write();
+
+    muxed.read();
+    for(size_t channel = 0; channel < nChannels; ++channel) {
+      for(size_t sample = 0; sample < nSamples; ++sample) {
+        BOOST_TEST_REQUIRE(muxed[channel][sample] == toCooked(rawValue(sample, channel)),
+            "channel " << channel << ", sample " << sample);
+      }
+    }
+
+    // write back modified data and check the multiplexed raw data
+    for(size_t channel = 0; channel < nChannels; ++channel) {
+      for(size_t sample = 0; sample < nSamples; ++sample) {
+        muxed[channel][sample] = toCooked(rawValue(sample + 1, channel));
+      }
+    }
+    muxed.write();
+
+    raw.read();
+    std::memcpy(rawData.data(), raw.data(), rawData.size() * sizeof(RawType));
+    for(size_t sample = 0; sample < nSamples; ++sample) {
+      for(size_t channel = 0; channel < nChannels; ++channel) {
+        BOOST_TEST_REQUIRE(toCooked(rawData[sample * nChannels + channel]) == toCooked(rawValue(sample + 1, channel)),
+            "channel " << channel << ", sample " << sample);
+      }
+    }
+  }
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testHomogeneousAreas) {
+  Device device("(dummy?map=muxedAdc.mapp)");
+  device.open();
+
+  checkHomogeneousArea<uint16_t>(device, "CH32", 32, 1000, [](uint16_t v) { return static_cast<int16_t>(v); });
+  checkHomogeneousArea<uint32_t>(device, "CH8", 8, 300, [](uint32_t v) { return static_cast<int32_t>(v) / 16.; });
+  checkHomogeneousArea<uint16_t>(
+      device, "CH5", 5, 101, [](uint16_t v) { return static_cast<int16_t>(static_cast<uint16_t>(v << 4)) / 16; });
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_SUITE_END()
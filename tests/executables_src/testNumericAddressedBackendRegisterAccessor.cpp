@@ -13,6 +13,7 @@ using namespace boost::unit_test_framework;
 #include "Device.h"
 #include "DummyBackend.h"
 #include "DummyRegisterAccessor.h"
+#include "ExceptionDummyBackend.h"
 #include "TransferGroup.h"
 
 namespace ChimeraTK {
@@ -275,6 +276,59 @@ BOOST_AUTO_TEST_CASE(testRawWithTransferGroup) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testRawZeroCopyRead) {
+  const std::string cdd = "(ExceptionDummy:1?map=goodMapFile.map)";
+  Device device;
+  device.open(cdd);
+  auto exceptionDummy = boost::dynamic_pointer_cast<ExceptionDummy>(BackendFactory::getInstance().createBackend(cdd));
+  BOOST_REQUIRE(exceptionDummy);
+
+  auto writer = device.getOneDRegisterAccessor<int>("MODULE1/TEST_AREA", 0, 0, {AccessMode::raw});
+  auto reader = device.getOneDRegisterAccessor<int>("MODULE1/TEST_AREA", 0, 0, {AccessMode::raw});
+
+  for(size_t i = 0; i < writer.getNElements(); ++i) {
+    writer[i] = int(i + 100);
+  }
+  writer.write();
+
+  // The data is read directly into a spare buffer which is swapped with the application buffer, hence the buffer
+  // changes with each read.
+  auto* bufferBefore = reader.data();
+  reader.read();
+  BOOST_CHECK(reader.data() != bufferBefore);
+  for(size_t i = 0; i < reader.getNElements(); ++i) {
+    BOOST_CHECK_EQUAL(reader[i], int(i + 100));
+  }
+
+  for(size_t i = 0; i < writer.getNElements(); ++i) {
+    writer[i] = int(i + 200);
+  }
+  writer.write();
+  reader.read();
+  for(size_t i = 0; i < reader.getNElements(); ++i) {
+    BOOST_CHECK_EQUAL(reader[i], int(i + 200));
+  }
+
+  // The application buffer must not be changed if the transfer fails
+  for(size_t i = 0; i < writer.getNElements(); ++i) {
+    writer[i] = int(i + 300);
+  }
+  writer.write();
+  exceptionDummy->throwExceptionRead = true;
+  BOOST_CHECK_THROW(reader.read(), ChimeraTK::runtime_error);
+  for(size_t i = 0; i < reader.getNElements(); ++i) {
+    BOOST_CHECK_EQUAL(reader[i], int(i + 200));
+  }
+  exceptionDummy->throwExceptionRead = false;
+  device.open();
+  reader.read();
+  for(size_t i = 0; i < reader.getNElements(); ++i) {
+    BOOST_CHECK_EQUAL(reader[i], int(i + 300));
+  }
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(testConversionTypes) {
   // The bit interpretation can either have a fixed number of fractional bits or be IEEE754 single precision.
   // We test those scenarios, and that raw and coocked accessors are working for all of them.
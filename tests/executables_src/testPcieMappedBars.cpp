@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE PcieMappedBarsTest
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "PcieBackend.h"
+#include "PcieMappedBars.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+// Regular files are used as stand-in for the sysfs resource files. BAR 0 and 2 are present, BAR 1 is empty.
+struct Fixture {
+  static constexpr size_t barSize = 4096;
+
+  Fixture() {
+    std::filesystem::create_directories(path);
+    for(size_t bar : {0, 2}) {
+      std::vector<int32_t> content(barSize / 4);
+      for(size_t i = 0; i < content.size(); ++i) {
+        content[i] = int32_t(bar * 1000 + i);
+      }
+      std::ofstream(prefix() + std::to_string(bar)).write(reinterpret_cast<const char*>(content.data()), barSize);
+    }
+    std::ofstream(prefix() + "1");
+  }
+
+  ~Fixture() { std::filesystem::remove_all(path); }
+
+  [[nodiscard]] std::string prefix() const { return (path / "resource").string(); }
+
+  [[nodiscard]] int32_t readFile(size_t bar, size_t index) const {
+    int32_t value;
+    std::ifstream file(prefix() + std::to_string(bar));
+    file.seekg(std::streamoff(index * 4));
+    file.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+  }
+
+  std::filesystem::path path{
+      std::filesystem::temp_directory_path() / ("testPcieMappedBars-" + std::to_string(getpid()))};
+};
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testMapping, Fixture) {
+  PcieMappedBars bars;
+  bars.map(prefix());
+  BOOST_TEST(bars.isMapped(0));
+  BOOST_TEST(!bars.isMapped(1)); // empty file
+  BOOST_TEST(bars.isMapped(2));
+  BOOST_TEST(!bars.isMapped(3)); // missing file
+  BOOST_TEST(!bars.isMapped(13));
+
+  std::vector<int32_t> data(4);
+  BOOST_TEST(bars.read(2, 16, data.data(), 16));
+  BOOST_TEST(data == std::vector<int32_t>({2004, 2005, 2006, 2007}), boost::test_tools::per_element());
+
+  std::vector<int32_t> newData{-1, 42};
+  BOOST_TEST(bars.write(0, 8, newData.data(), 8));
+  BOOST_TEST(readFile(0, 2) == -1);
+  BOOST_TEST(readFile(0, 3) == 42);
+
+  bars.unmap();
+  BOOST_TEST(!bars.isMapped(0));
+  BOOST_TEST(!bars.read(2, 16, data.data(), 16));
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testFallback, Fixture) {
+  PcieMappedBars bars;
+  std::vector<int32_t> data(2);
+
+  // accesses which cannot be served from the mapped memory report false, so the backend uses the driver instead
+  bars.map(prefix());
+  BOOST_TEST(!bars.read(1, 0, data.data(), 4));            // BAR not mapped
+  BOOST_TEST(!bars.read(0, barSize - 4, data.data(), 8));  // beyond the end
+  BOOST_TEST(!bars.read(0, 2, data.data(), 4));            // unaligned
+  BOOST_TEST(!bars.write(0, barSize, data.data(), 4));     // beyond the end
+  BOOST_TEST(!bars.read(0xD, 0, data.data(), 4));          // DMA
+
+  // no prefix (not a character device): nothing mapped
+  bars.map("");
+  BOOST_TEST(!bars.isMapped(0));
+  BOOST_TEST(PcieMappedBars::getResourcePrefix(-1).empty());
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testConcurrentUnmap, Fixture) {
+  // Unmapping while other threads are accessing the BARs must never crash. The accesses either see the mapped data
+  // or report that the BAR is not mapped.
+  PcieMappedBars bars;
+  bars.map(prefix());
+
+  std::atomic<bool> stop{false};
+  std::atomic<bool> wrongData{false};
+  std::vector<std::thread> threads;
+  for(size_t t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      std::vector<int32_t> data(barSize / 4);
+      auto lastValue = int32_t(2000 + data.size() - 1);
+      while(!stop) {
+        if(bars.read(2, 0, data.data(), barSize) && (data[0] != 2000 || data.back() != lastValue)) {
+          wrongData = true;
+        }
+      }
+    });
+  }
+
+  for(size_t i = 0; i < 200; ++i) {
+    bars.unmap();
+    bars.map(prefix());
+  }
+  stop = true;
+  for(auto& t : threads) {
+    t.join();
+  }
+  BOOST_TEST(!wrongData);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testParameters) {
+  BOOST_CHECK_THROW(PcieBackend::createInstance("nonexistent", {{"mmap", "2"}}), logic_error);
+  BOOST_CHECK_THROW(PcieBackend::createInstance("nonexistent", {{"mmap", "yes"}}), logic_error);
+
+  for(const auto* value : {"0", "1"}) {
+    auto backend = PcieBackend::createInstance("nonexistent", {{"mmap", value}});
+    BOOST_CHECK_THROW(backend->open(), runtime_error);
+    BOOST_TEST(!backend->isOpen());
+  }
+}
+
+/**********************************************************************************************************************/
@@ -39,6 +39,7 @@ using namespace boost::unit_test_framework;
 #include "RawConverter.h"
 
 #include <cfloat>
+#include <cmath>
 #include <sstream>
 namespace ChimeraTK {
   using namespace ChimeraTK;
@@ -1856,3 +1857,104 @@ BOOST_AUTO_TEST_CASE(test_toCooked_00) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+/**********************************************************************************************************************/
+/*      ARRAY CONVERSION TEST SECTION                                                                                 */
+/**********************************************************************************************************************/
+
+// Equality which also treats NaN as equal to NaN (raw bit patterns like 0xFFFFFFFF are NaN in IEEE754)
+template<typename T>
+bool sameValue(const T& a, const T& b) {
+  if constexpr(std::is_floating_point_v<T>) {
+    if(std::isnan(a) && std::isnan(b)) {
+      return true;
+    }
+  }
+  return a == b;
+}
+
+/**********************************************************************************************************************/
+
+// Compare the array conversion functions with the scalar conversion for the given register info
+template<typename UserType, typename RawType>
+void checkArrayConversion(const ChimeraTK::NumericAddressedRegisterInfo& info, const std::vector<RawType>& rawValues) {
+  RawConverter::withConverter<UserType, RawType>(info, 0, [&](auto converter) {
+    std::vector<UserType> cookedValues(rawValues.size());
+    converter.toCooked(rawValues, cookedValues);
+    for(size_t i = 0; i < rawValues.size(); ++i) {
+      BOOST_TEST(sameValue(cookedValues[i], converter.toCooked(rawValues[i])),
+          "index " << i << " for " << typeName<UserType>());
+    }
+
+    std::vector<RawType> rawValuesBack(rawValues.size());
+    converter.toRaw(cookedValues, rawValuesBack);
+    for(size_t i = 0; i < rawValues.size(); ++i) {
+      BOOST_TEST(
+          rawValuesBack[i] == converter.toRaw(cookedValues[i]), "index " << i << " for " << typeName<UserType>());
+    }
+  });
+}
+
+/**********************************************************************************************************************/
+
+template<typename RawType>
+void checkArrayConversionAllTypes(const ChimeraTK::NumericAddressedRegisterInfo& info) {
+  std::vector<RawType> rawValues;
+  for(uint64_t v : {0x0UL, 0x1UL, 0x7FUL, 0x80UL, 0xFFUL, 0x1FFFFUL, 0x20000UL, 0x3FFFFUL, 0x55555555UL, 0xAAAAAAAAUL,
+          0xFFFFFFFFUL, 0x40490FDBUL /* pi as float */, 0xC2F0B333UL /* -120.35 as float */}) {
+    rawValues.push_back(RawType(v));
+  }
+  checkArrayConversion<int8_t>(info, rawValues);
+  checkArrayConversion<uint8_t>(info, rawValues);
+  checkArrayConversion<int16_t>(info, rawValues);
+  checkArrayConversion<uint16_t>(info, rawValues);
+  checkArrayConversion<int32_t>(info, rawValues);
+  checkArrayConversion<uint32_t>(info, rawValues);
+  checkArrayConversion<int64_t>(info, rawValues);
+  checkArrayConversion<uint64_t>(info, rawValues);
+  checkArrayConversion<float>(info, rawValues);
+  checkArrayConversion<double>(info, rawValues);
+  checkArrayConversion<std::string>(info, rawValues);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_SUITE(ArrayConversionTestSuite)
+
+BOOST_AUTO_TEST_CASE(testArrayConversion) {
+  using Info = ChimeraTK::NumericAddressedRegisterInfo;
+  // width, fractional bits, signed
+  for(auto [width, fracBits, isSigned] : std::vector<std::tuple<uint32_t, int32_t, bool>>{{16, 0, true},
+          {16, 3, true}, {16, 3, false}, {32, 0, true}, {32, 12, true}, {32, -4, false}, {18, 0, true}, {18, 0, false},
+          {18, 7, true}, {18, -12, true}, {12, 3, true}}) {
+    BOOST_TEST_CONTEXT("width " << width << ", fractional bits " << fracBits << ", signed " << isSigned) {
+      Info info("", 1, 0, 4, 0, width, fracBits, isSigned);
+      if(width <= 16) {
+        checkArrayConversionAllTypes<uint16_t>(info);
+      }
+      checkArrayConversionAllTypes<uint32_t>(info);
+    }
+  }
+
+  // IEEE754 pass-through
+  Info info("", 1, 0, 4, 0, 32, 0, true, Info::Access::READ_WRITE, Info::Type::IEEE754);
+  checkArrayConversionAllTypes<uint32_t>(info);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testSignExtension) {
+  // check the branch-free sign extension of arbitrary bit widths explicitly
+  ChimeraTK::NumericAddressedRegisterInfo info("", 1, 0, 4, 0, 18, 0, true);
+  std::vector<uint32_t> rawValues{0x0, 0x1, 0x1FFFF, 0x20000, 0x3FFFF, 0xFFFC0001, 0x12345};
+  std::vector<int32_t> expected{0, 1, 131071, -131072, -1, 1, 0x12345};
+  RawConverter::withConverter<int32_t, uint32_t>(info, 0, [&](auto converter) {
+    std::vector<int32_t> cookedValues(rawValues.size());
+    converter.toCooked(rawValues, cookedValues);
+    BOOST_CHECK_EQUAL_COLLECTIONS(cookedValues.begin(), cookedValues.end(), expected.begin(), expected.end());
+  });
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_SUITE_END()
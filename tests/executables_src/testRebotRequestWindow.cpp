@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE RebotRequestWindowTest
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "Device.h"
+#include "RebotDummyServer.h"
+#include "TransferGroup.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+// Test fixture running the dummy server in this process, so the test can look into the session.
+struct F {
+  F()
+  : rebotServer{0 /*use random port*/, "./mtcadummy_rebot.map", 1 /*protocol version*/},
+    serverThread([&]() { rebotServer.start(); }) {
+    while(not rebotServer.is_running()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  ~F() {
+    rebotServer.stop();
+    serverThread.join();
+  }
+
+  // Read and write a TransferGroup with three non-adjacent registers, so the backend has three low-level transfers
+  // which it can send together.
+  void transferGroup(Device& device) {
+    auto status = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_STATUS");
+    auto clockCount = device.getScalarRegisterAccessor<int32_t>("ADC.WORD_CLK_CNT_1");
+    auto clockMux = device.getScalarRegisterAccessor<int32_t>("ADC.WORD_CLK_MUX_1");
+
+    TransferGroup group;
+    group.addAccessor(status);
+    group.addAccessor(clockCount);
+    group.addAccessor(clockMux);
+
+    for(int32_t i = 0; i < 10; ++i) {
+      status = i;
+      clockCount = 2 * i;
+      clockMux = 3 * i;
+      group.write();
+      status = -1;
+      clockCount = -1;
+      clockMux = -1;
+      group.read();
+      BOOST_TEST(int32_t(status) == i);
+      BOOST_TEST(int32_t(clockCount) == 2 * i);
+      BOOST_TEST(int32_t(clockMux) == 3 * i);
+    }
+  }
+
+  RebotDummyServer rebotServer;
+  boost::thread serverThread;
+};
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testPipelined, F) {
+  Device device("(rebot?ip=localhost&port=" + std::to_string(rebotServer.port()) +
+      "&map=mtcadummy_rebot.map&requestWindow=8)");
+  device.open();
+  transferGroup(device);
+
+  // The requests of one group transfer are sent together and must arrive at the server before the first response
+  BOOST_TEST(rebotServer.session()->_maxRequestsInFlight > 1);
+  device.close();
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testNotPipelined, F) {
+  Device device("(rebot?ip=localhost&port=" + std::to_string(rebotServer.port()) +
+      "&map=mtcadummy_rebot.map&requestWindow=1)");
+  device.open();
+  transferGroup(device);
+
+  // Each request waits for the response of the previous one
+  BOOST_TEST(rebotServer.session()->_maxRequestsInFlight == 1);
+  device.close();
+}
+
+/**********************************************************************************************************************/
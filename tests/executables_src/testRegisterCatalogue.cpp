@@ -25,6 +25,8 @@ class myRegisterInfo : public BackendRegisterInfoBase {
 
   [[nodiscard]] RegisterPath getRegisterName() const override { return _path; }
 
+  void setAltSeparator(const std::string& altSeparator) { _path.setAltSeparator(altSeparator); }
+
   [[nodiscard]] unsigned int getNumberOfElements() const override { return _nbOfElements; }
 
   [[nodiscard]] unsigned int getNumberOfChannels() const override { return _nbOfChannels; }
@@ -254,4 +256,91 @@ BOOST_AUTO_TEST_CASE(TestHiddenRegisters) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(TestAltSeparatorLookup) {
+  CatalogueGenerator generator;
+  BackendRegisterCatalogue<myRegisterInfo> catalogue;
+
+  // register name with "." as alternative separator, like e.g. in the NumericAddressedRegisterInfo
+  myRegisterInfo dotted{"MODULE.REGISTER", 1, 1, 0, generator.dataDescriptor, true, true, {}};
+  dotted.setAltSeparator(".");
+  catalogue.addRegister(dotted);
+  catalogue.addRegister(generator.theInfo);
+
+  // registers with an alternative separator in the name are found with both notations
+  BOOST_TEST(catalogue.hasRegister("/MODULE/REGISTER"));
+  BOOST_TEST(catalogue.hasRegister("MODULE.REGISTER"));
+  BOOST_TEST(catalogue.getRegister("MODULE.REGISTER").getRegisterName() == "/MODULE/REGISTER");
+  BOOST_TEST(!catalogue.hasRegister("MODULE.OTHER"));
+
+  RegisterPath otherDotted("some.register.name");
+  otherDotted.setAltSeparator(".");
+  BOOST_TEST(catalogue.hasRegister(otherDotted));
+
+  BOOST_CHECK_THROW(catalogue.addRegister(myRegisterInfo{"/MODULE/REGISTER", 1, 1, 0, generator.dataDescriptor, true,
+                        true, {}}),
+      ChimeraTK::logic_error);
+
+  auto cloned = catalogue.clone();
+  BOOST_TEST(cloned->hasRegister("MODULE.REGISTER"));
+
+  catalogue.removeRegister("MODULE.REGISTER");
+  BOOST_TEST(!catalogue.hasRegister("/MODULE/REGISTER"));
+  BOOST_TEST(catalogue.getNumberOfRegisters() == 1);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(TestLiteralAltSeparatorLookup) {
+  CatalogueGenerator generator;
+  BackendRegisterCatalogue<myRegisterInfo> catalogue;
+
+  // register name containing a literal "." without alternative separator
+  catalogue.addRegister(myRegisterInfo{"/MODULE.REGISTER", 1, 1, 0, generator.dataDescriptor, true, true, {}});
+
+  // found when searching with "." as alternative separator, as RegisterPath compares both as "/MODULE/REGISTER"
+  RegisterPath dotted("MODULE.REGISTER");
+  dotted.setAltSeparator(".");
+  BOOST_TEST(catalogue.hasRegister(dotted));
+  BOOST_TEST(catalogue.getRegister(dotted).getRegisterName() == "/MODULE.REGISTER");
+  BOOST_TEST(catalogue.hasRegister("/MODULE.REGISTER"));
+
+  // without alternative separator the "." is part of the name
+  BOOST_TEST(!catalogue.hasRegister("/MODULE/REGISTER"));
+
+  catalogue.removeRegister(dotted);
+  BOOST_TEST(catalogue.getNumberOfRegisters() == 0);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(TestSnapshot) {
+  CatalogueGenerator generator;
+  auto catalogue = generator.generateCatalogue();
+
+  // snapshots are shared until the catalogue is modified
+  auto snapshot = catalogue.getSnapshot();
+  BOOST_TEST(snapshot == catalogue.getSnapshot());
+  BOOST_TEST(snapshot.get() != &catalogue);
+  BOOST_TEST(snapshot->getNumberOfRegisters() == 3);
+
+  RegisterCatalogue userCatalogue(snapshot);
+  RegisterCatalogue userCatalogueCopy(userCatalogue);
+  BOOST_TEST(&userCatalogueCopy.getImpl() == snapshot.get());
+
+  catalogue.removeRegister("/justAName");
+  auto newSnapshot = catalogue.getSnapshot();
+  BOOST_TEST(newSnapshot != snapshot);
+  BOOST_TEST(newSnapshot->getNumberOfRegisters() == 2);
+  // existing snapshots are not affected
+  BOOST_TEST(userCatalogueCopy.getNumberOfRegisters() == 3);
+  BOOST_TEST(userCatalogueCopy.hasRegister("/justAName"));
+
+  // modification through the non-const iterator
+  for([[maybe_unused]] auto& info : catalogue) {
+  }
+  BOOST_TEST(catalogue.getSnapshot() != newSnapshot);
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -19,6 +19,7 @@ class RegisterPathTest {
   void testRegisterPath();
   void testNumericAddresses();
   void testComponents();
+  void testHash();
 };
 
 class RegisterPathTestSuite : public test_suite {
@@ -29,6 +30,7 @@ class RegisterPathTestSuite : public test_suite {
     add(BOOST_CLASS_TEST_CASE(&RegisterPathTest::testRegisterPath, registerPathTest));
     add(BOOST_CLASS_TEST_CASE(&RegisterPathTest::testNumericAddresses, registerPathTest));
     add(BOOST_CLASS_TEST_CASE(&RegisterPathTest::testComponents, registerPathTest));
+    add(BOOST_CLASS_TEST_CASE(&RegisterPathTest::testHash, registerPathTest));
   }
 };
 
@@ -120,3 +122,29 @@ void RegisterPathTest::testComponents() {
   BOOST_CHECK(comps3.size() == 1);
   BOOST_CHECK(comps3[0] == "singleComponent");
 }
+
+void RegisterPathTest::testHash() {
+  std::hash<RegisterPath> hash;
+
+  // paths which compare equal have the same hash, regardless of their alternative separators
+  RegisterPath literalDot("/SomeModule.withSomeRegister");
+  RegisterPath dotSeparated("SomeModule.withSomeRegister");
+  dotSeparated.setAltSeparator(".");
+  RegisterPath slashSeparated("/SomeModule//withSomeRegister/");
+  BOOST_CHECK(literalDot == dotSeparated);
+  BOOST_CHECK(dotSeparated == slashSeparated);
+  BOOST_CHECK(hash(literalDot) == hash(dotSeparated));
+  BOOST_CHECK(hash(dotSeparated) == hash(slashSeparated));
+
+  // the hash is updated when the path is modified
+  RegisterPath modified("/SomeModule");
+  modified /= "withSomeRegister";
+  BOOST_CHECK(hash(modified) == hash(slashSeparated));
+  modified--;
+  BOOST_CHECK(hash(modified) == hash(RegisterPath("SomeModule")));
+
+  // different paths have different hashes, also if they only differ in the separators
+  BOOST_CHECK(hash(RegisterPath("/SomeModule/withSomeRegister")) != hash(RegisterPath("/SomeModulewithSomeRegister")));
+  BOOST_CHECK(hash(RegisterPath("/SomeModule")) != hash(RegisterPath("/")));
+  BOOST_CHECK(hash(RegisterPath("/")) == hash(RegisterPath("//")));
+}
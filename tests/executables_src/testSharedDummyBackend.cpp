@@ -10,6 +10,8 @@
 #include "sharedDummyHelpers.h"
 #include "Utilities.h"
 
+#include <sys/wait.h>
+
 #include <boost/filesystem.hpp>
 #include <boost/interprocess/managed_shared_memory.hpp>
 #include <boost/test/unit_test.hpp>
@@ -17,6 +19,7 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
 #include <string>
@@ -156,6 +159,139 @@ namespace {
 
   /********************************************************************************************************************/
 
+  BOOST_AUTO_TEST_CASE(testConcurrentAccess) {
+    setDMapFilePath("shareddummyTest.dmap");
+    Device dev;
+    dev.open("SHDMEMDEV");
+
+    // A writer fills the whole area with the same value over and over again. Readers must never see a mixture of two
+    // writes.
+    constexpr int nWrites = 2000;
+    auto area = dev.getOneDRegisterAccessor<int>("FEATURE2/AREA3");
+    std::fill(area.begin(), area.end(), 0);
+    area.write();
+
+    std::atomic<bool> done{false};
+    std::atomic<size_t> nTornReads{0};
+    std::vector<std::thread> readers;
+    for(size_t i = 0; i < 3; ++i) {
+      readers.emplace_back([&, readArea = dev.getOneDRegisterAccessor<int>("FEATURE2/AREA3")]() mutable {
+        while(!done) {
+          readArea.read();
+          if(std::any_of(readArea.begin(), readArea.end(), [&](int v) { return v != readArea[0]; })) {
+            ++nTornReads;
+          }
+        }
+      });
+    }
+
+    for(int i = 1; i <= nWrites; ++i) {
+      std::fill(area.begin(), area.end(), i);
+      area.write();
+    }
+    done = true;
+    for(auto& t : readers) {
+      t.join();
+    }
+    BOOST_CHECK_EQUAL(nTornReads, 0);
+
+    area.read();
+    BOOST_CHECK(std::all_of(area.begin(), area.end(), [](int v) { return v == nWrites; }));
+
+    // access outside of the bar is still detected
+    auto backend = boost::dynamic_pointer_cast<SharedDummyBackend>(
+        BackendFactory::getInstance().createBackend("SHDMEMDEV"));
+    std::vector<int32_t> buffer(2);
+    BOOST_CHECK_THROW(backend->read(uint64_t(2), 420, buffer.data(), 8), ChimeraTK::logic_error);
+    BOOST_CHECK_THROW(backend->read(uint64_t(7), 0, buffer.data(), 8), ChimeraTK::logic_error);
+
+    dev.close();
+  }
+
+  /********************************************************************************************************************/
+
+  BOOST_AUTO_TEST_CASE(testStaleWriteLock) {
+    setDMapFilePath("shareddummyTest.dmap");
+    Device dev;
+    dev.open("SHDMEMDEV");
+    auto area = dev.getOneDRegisterAccessor<int>("FEATURE2/AREA3");
+
+    // access the sequence lock of bar 2 (containing AREA3) directly in the shared memory
+    std::string shmName = Utilities::createShmName(Utilities::shmDummyInstanceIdHash("1", {{"map", "shareddummy.map"}}),
+        boost::filesystem::canonical("shareddummy.map").string(), getUserName());
+    boost::interprocess::managed_shared_memory segment(boost::interprocess::open_only, shmName.c_str());
+    auto* seqLock = segment.find<SharedDummyBackend::BarSeqLock>("BAR_2_SEQLOCK").first;
+    BOOST_REQUIRE(seqLock != nullptr);
+    constexpr uint64_t sequenceIncrement = uint64_t(1) << 32;
+
+    // A write lock held by a living process is never released by others, no matter how long it is held.
+    auto stable = seqLock->state.load();
+    seqLock->state = stable + sequenceIncrement + getOwnPID();
+    std::atomic<bool> written{false};
+    std::thread writer([&] {
+      area.write();
+      written = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    BOOST_CHECK(!written);
+    seqLock->state = stable + 2 * sequenceIncrement;
+    writer.join();
+    BOOST_CHECK(written);
+
+    // A write lock held by a process which no longer exists (crashed while writing) is released.
+    auto childPid = ::fork();
+    if(childPid == 0) {
+      ::_exit(0);
+    }
+    BOOST_REQUIRE(childPid > 0);
+    BOOST_REQUIRE(::waitpid(childPid, nullptr, 0) == childPid);
+    stable = seqLock->state.load();
+    seqLock->state = stable + sequenceIncrement + uint64_t(childPid);
+    std::fill(area.begin(), area.end(), 42);
+    area.write();
+    BOOST_CHECK_EQUAL(seqLock->state.load() & (sequenceIncrement - 1), 0);
+    area.read();
+    BOOST_CHECK(std::all_of(area.begin(), area.end(), [](int v) { return v == 42; }));
+
+    dev.close();
+  }
+
+  /********************************************************************************************************************/
+
+  BOOST_AUTO_TEST_CASE(testLayoutVersion) {
+    setDMapFilePath("shareddummyTest.dmap");
+    // use an instance hash not used by any dmap entry, so the segment is private to this test
+    constexpr size_t instanceIdHash = 4711;
+    std::string mapFileName = boost::filesystem::canonical("shareddummy.map").string();
+    std::string shmName = Utilities::createShmName(instanceIdHash, mapFileName, getUserName());
+    boost::interprocess::shared_memory_object::remove(shmName.c_str());
+
+    // A segment with an incompatible layout which is not used by anyone is replaced.
+    {
+      boost::interprocess::managed_shared_memory segment(boost::interprocess::create_only, shmName.c_str(), 65536);
+      segment.construct<unsigned>("RequiredVersion")(0);
+    }
+    auto backend = std::make_unique<SharedDummyBackend>(instanceIdHash, mapFileName);
+    boost::interprocess::managed_shared_memory segment(boost::interprocess::open_only, shmName.c_str());
+    auto* version = segment.find<unsigned>("RequiredVersion").first;
+    BOOST_REQUIRE(version != nullptr);
+    BOOST_CHECK_NE(*version, 0);
+
+    // A segment with an incompatible layout which is still in use cannot be accessed.
+    auto correctVersion = *version;
+    *version = 0;
+    BOOST_CHECK_THROW(SharedDummyBackend(instanceIdHash, mapFileName), ChimeraTK::runtime_error);
+    *version = correctVersion;
+
+    // the last user removes the segment
+    backend.reset();
+    BOOST_CHECK_THROW(
+        boost::interprocess::managed_shared_memory(boost::interprocess::open_only, shmName.c_str()),
+        boost::interprocess::interprocess_exception);
+  }
+
+  /********************************************************************************************************************/
+
   BOOST_FIXTURE_TEST_CASE(testCreateBackend, TestFixture) {
     setDMapFilePath("shareddummyTest.dmap");
     auto backendInst1 = BackendFactory::getInstance().createBackend("SHDMEMDEV");
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
 #include "Device.h"
+#include "SubdeviceBackend.h"
 
 #include <thread>
 
@@ -509,6 +510,92 @@ BOOST_AUTO_TEST_CASE(test3regsScalar) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(test3regsAdaptivePolling) {
+  setDMapFilePath("subdeviceTest.dmap");
+
+  Device dev;
+  dev.open("SUBDEV2_ADAPTIVE");
+  Device target;
+  target.open("TARGET1");
+  auto backend = boost::dynamic_pointer_cast<SubdeviceBackend>(dev.getBackend());
+  BOOST_REQUIRE(backend);
+
+  auto acc = dev.getScalarRegisterAccessor<double>("APP.0.MY_REGISTER1");
+  auto accD = target.getScalarRegisterAccessor<int32_t>("APP.1.DATA");
+  auto accS = target.getScalarRegisterAccessor<int32_t>("APP.1.STATUS");
+
+  // status is already cleared: the first poll is done without sleeping
+  accS.setAndWrite(0);
+  acc.setAndWrite(12);
+  auto stat = backend->getBusyWaitStatistics();
+  BOOST_TEST(stat.nWaits == 1);
+  BOOST_TEST(stat.nPolls == 1);
+
+  // status stays set for a while: spin, then back off up to the sleep time of 1 ms
+  accS.setAndWrite(1);
+  std::atomic<bool> done{false};
+  std::thread t([&] {
+    acc.setAndWrite(34);
+    done = true;
+  });
+  usleep(20000);
+  BOOST_CHECK(done == false);
+  accS.setAndWrite(0);
+  t.join();
+  accD.read();
+  BOOST_TEST(accD == 34);
+
+  stat = backend->getBusyWaitStatistics();
+  BOOST_TEST(stat.nWaits == 2);
+  BOOST_TEST(stat.nPolls > 6);
+  BOOST_TEST(stat.nPolls < 1000);
+  BOOST_TEST(stat.maxWaitTime >= std::chrono::milliseconds(20));
+  BOOST_TEST(stat.totalWaitTime >= stat.maxWaitTime);
+
+  dev.close();
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(test3regsBusyPush) {
+  setDMapFilePath("subdeviceTest.dmap");
+
+  Device target;
+  target.open("TARGET1");
+  auto accD = target.getScalarRegisterAccessor<int32_t>("APP.1.DATA");
+  auto accS = target.getScalarRegisterAccessor<int32_t>("APP.1.STATUS");
+  auto trigger = target.getVoidRegisterAccessor("/DUMMY_INTERRUPT_1");
+  accS.setAndWrite(1);
+
+  Device dev;
+  dev.open("SUBDEV2_PUSH");
+  dev.activateAsyncRead();
+  auto acc = dev.getScalarRegisterAccessor<double>("APP.0.MY_REGISTER1");
+
+  std::atomic<bool> done{false};
+  std::thread t([&] {
+    acc.setAndWrite(56);
+    done = true;
+  });
+  usleep(10000);
+  BOOST_CHECK(done == false);
+
+  // clearing the status register alone does not complete the transaction, since it is not polled
+  accS.setAndWrite(0);
+  usleep(10000);
+  BOOST_CHECK(done == false);
+
+  // the interrupt pushes the cleared status
+  trigger.write();
+  t.join();
+  accD.read();
+  BOOST_TEST(accD == 56);
+
+  dev.close();
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(test3regsArray) {
   setDMapFilePath("subdeviceTest.dmap");
 
@@ -368,4 +368,47 @@ BOOST_AUTO_TEST_CASE(TestMutex) {
 
 /**********************************************************************************************************************/
 
+/// Test that in burst mode the address is written and the busy flag is awaited only once per burst.
+BOOST_AUTO_TEST_CASE(TestBurst) {
+  setDMapFilePath("subdeviceTest.dmap");
+
+  ChimeraTK::Device device(
+      "(subdevice?type=regWindow&device=TARGET1&address=APP.REG_WIN.ADDRESS&writeData=APP.REG_WIN.WRITE_DATA&busy=APP."
+      "REG_WIN.BUSY&readRequest=APP.REG_WIN.READ_REQUEST&readData=APP.REG_WIN.READOUT_SINGLE&burst=4"
+      "&map=Subdevice.map)");
+  device.open();
+
+  ChimeraTK::Device targetDevice("TARGET1");
+  auto dummyTarget = boost::dynamic_pointer_cast<DummyBackend>(targetDevice.getBackend());
+
+  DummyRegisterAccessor<uint32_t> accAddress{dummyTarget.get(), "APP.REG_WIN", "ADDRESS"};
+  DummyRegisterAccessor<uint32_t> accWriteData{dummyTarget.get(), "APP.REG_WIN", "WRITE_DATA"};
+  DummyRegisterAccessor<uint32_t> accReadRequest{dummyTarget.get(), "APP.REG_WIN", "READ_REQUEST"};
+
+  std::vector<uint32_t> addresses;
+  std::vector<uint32_t> data;
+  size_t nReadRequests{0};
+  accAddress.setWriteCallback([&] { addresses.push_back(accAddress); });
+  accWriteData.setWriteCallback([&] { data.push_back(accWriteData); });
+  accReadRequest.setWriteCallback([&] { ++nReadRequests; });
+
+  // MY_AREA1 has 6 words starting at address 2 (in units of the 32 bit data register), so there are two bursts
+  auto acc = device.getOneDRegisterAccessor<int32_t>("APP/0/MY_AREA1", 0, 0, {AccessMode::raw});
+  acc = std::vector<int32_t>{10, 11, 12, 13, 14, 15};
+  acc.write();
+  BOOST_TEST(addresses == std::vector<uint32_t>({2, 6}), boost::test_tools::per_element());
+  BOOST_TEST(data == std::vector<uint32_t>({10, 11, 12, 13, 14, 15}), boost::test_tools::per_element());
+
+  addresses.clear();
+  acc.read();
+  BOOST_TEST(addresses == std::vector<uint32_t>({2, 6}), boost::test_tools::per_element());
+  BOOST_TEST(nReadRequests == 2);
+
+  BOOST_CHECK_THROW(ChimeraTK::Device("(subdevice?type=3regs&device=TARGET1&address=APP.1.ADDRESS&data=APP.1.DATA"
+                                      "&status=APP.1.STATUS&burst=4&map=Subdevice.map)"),
+      ChimeraTK::logic_error);
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_SUITE_END()
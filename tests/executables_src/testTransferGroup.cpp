@@ -1052,3 +1052,158 @@ BOOST_AUTO_TEST_CASE(testTemporaryAbstractorWorks) {
 }
 
 /**********************************************************************************************************************/
+
+/// Helper to inspect the low-level elements of a TransferGroup
+struct TestableTransferGroup : TransferGroup {
+  size_t getNumberOfLowLevelElements() { return _lowLevelElementsAndExceptionFlags.size(); }
+};
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testMergePolicy) {
+  BackendFactory::getInstance().setDMapFilePath("dummies.dmap");
+  ChimeraTK::Device device;
+
+  // Without merge policy, only adjacent/overlapping areas are merged
+  {
+    device.open("(dummy?map=mtcadummy.map)");
+    auto firmware = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_FIRMWARE");
+    auto status = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_STATUS");
+    TestableTransferGroup group;
+    group.addAccessor(firmware);
+    group.addAccessor(status);
+    BOOST_CHECK_EQUAL(group.getNumberOfLowLevelElements(), 2);
+    device.close();
+  }
+
+  // Merge across gaps of up to 16 bytes
+  {
+    device.open("(dummy?map=mtcadummy.map&maxMergeGap=16)");
+    auto firmware = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_FIRMWARE"); // 0x00
+    auto status = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_STATUS");     // 0x08
+    auto mux0 = device.getScalarRegisterAccessor<int32_t>("ADC.WORD_CLK_MUX_0");      // 0x20
+    auto compilation = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_COMPILATION");
+    auto firmware2 = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_FIRMWARE");
+    auto status2 = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_STATUS");
+
+    TestableTransferGroup group;
+    group.addAccessor(firmware);
+    group.addAccessor(status);
+    BOOST_CHECK_EQUAL(group.getNumberOfLowLevelElements(), 1);
+    group.addAccessor(mux0); // gap of 20 bytes is too big
+    BOOST_CHECK_EQUAL(group.getNumberOfLowLevelElements(), 2);
+
+    firmware2 = 42;
+    firmware2.write();
+    status2 = 43;
+    status2.write();
+    group.read();
+    BOOST_CHECK_EQUAL(int(firmware), 42);
+    BOOST_CHECK_EQUAL(int(status), 43);
+
+    // the gap must not be written
+    compilation = 120;
+    compilation.write();
+    firmware = 1;
+    status = 2;
+    group.write();
+    compilation.read();
+    BOOST_CHECK_EQUAL(int(compilation), 120);
+    firmware2.read();
+    BOOST_CHECK_EQUAL(int(firmware2), 1);
+    status2.read();
+    BOOST_CHECK_EQUAL(int(status2), 2);
+    device.close();
+  }
+
+  // Limit the size of merged transfers
+  {
+    device.open("(dummy?map=mtcadummy.map&maxMergeSize=4)");
+    auto firmware = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_FIRMWARE");
+    auto compilation = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_COMPILATION");
+    auto status = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_STATUS");
+    auto clkCnt = device.getOneDRegisterAccessor<int32_t>("ADC.WORD_CLK_CNT");
+    auto clkCnt1 = device.getScalarRegisterAccessor<int32_t>("ADC.WORD_CLK_CNT_1");
+    TestableTransferGroup group;
+    group.addAccessor(firmware);
+    group.addAccessor(compilation);
+    group.addAccessor(status);
+    BOOST_CHECK_EQUAL(group.getNumberOfLowLevelElements(), 3);
+
+    // single transfers are never split, and an area contained in a bigger one is always merged
+    group.addAccessor(clkCnt);
+    group.addAccessor(clkCnt1);
+    BOOST_CHECK_EQUAL(group.getNumberOfLowLevelElements(), 4);
+    device.close();
+  }
+
+  BOOST_CHECK_THROW(device.open("(dummy?map=mtcadummy.map&maxMergeGap=foo)"), ChimeraTK::logic_error);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testMergeMultiplexed) {
+  ChimeraTK::Device device("(dummy?map=muxedAdc.mapp)");
+  device.open();
+
+  // 5 channels of 16 bit per sample, 101 samples. The status word follows directly behind the area.
+  auto muxed = device.getTwoDRegisterAccessor<int32_t>("ADC/CH5");
+  auto status = device.getScalarRegisterAccessor<int32_t>("ADC/STATUS");
+  auto muxed2 = device.getTwoDRegisterAccessor<int32_t>("ADC/CH5");
+  auto status2 = device.getScalarRegisterAccessor<int32_t>("ADC/STATUS");
+
+  // multiplexed area and neighbouring register are read in a single transfer
+  TestableTransferGroup group;
+  group.addAccessor(muxed);
+  group.addAccessor(status);
+  BOOST_CHECK_EQUAL(group.getNumberOfLowLevelElements(), 1);
+
+  for(size_t channel = 0; channel < 5; ++channel) {
+    for(size_t sample = 0; sample < 101; ++sample) {
+      muxed2[channel][sample] = static_cast<int32_t>(channel * 100 + sample) - 1000;
+    }
+  }
+  muxed2.write();
+  status2 = 42;
+  status2.write();
+
+  group.read();
+  BOOST_CHECK_EQUAL(int(status), 42);
+  for(size_t channel = 0; channel < 5; ++channel) {
+    for(size_t sample = 0; sample < 101; ++sample) {
+      BOOST_CHECK_EQUAL(muxed[channel][sample], static_cast<int32_t>(channel * 100 + sample) - 1000);
+    }
+  }
+
+  // accessors to different sample ranges of the same area are merged as well
+  auto first = device.getTwoDRegisterAccessor<int32_t>("ADC/CH5", 50, 0);
+  auto second = device.getTwoDRegisterAccessor<int32_t>("ADC/CH5", 51, 50);
+  TestableTransferGroup group2;
+  group2.addAccessor(first);
+  group2.addAccessor(second);
+  BOOST_CHECK_EQUAL(group2.getNumberOfLowLevelElements(), 1);
+
+  for(size_t channel = 0; channel < 5; ++channel) {
+    for(size_t sample = 0; sample < 50; ++sample) {
+      first[channel][sample] = static_cast<int32_t>(channel + sample);
+    }
+    for(size_t sample = 0; sample < 51; ++sample) {
+      second[channel][sample] = -static_cast<int32_t>(channel + sample);
+    }
+  }
+  group2.write();
+
+  // the neighbouring register must not be affected
+  muxed2.read();
+  status2.read();
+  BOOST_CHECK_EQUAL(int(status2), 42);
+  for(size_t channel = 0; channel < 5; ++channel) {
+    for(size_t sample = 0; sample < 101; ++sample) {
+      auto expected =
+          sample < 50 ? static_cast<int32_t>(channel + sample) : -static_cast<int32_t>(channel + sample - 50);
+      BOOST_CHECK_EQUAL(muxed2[channel][sample], expected);
+    }
+  }
+}
+
+/**********************************************************************************************************************/
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE UioAccessTest
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "Exception.h"
+#include "UioAccess.h"
+#include "UioBackend.h"
+
+#include <boost/make_shared.hpp>
+
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <tuple>
+#include <vector>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+// Fake sysfs tree for a UIO device with two memory regions. The device file is a regular file, in which region N is
+// mapped at an offset of N pages as done by the UIO driver.
+struct Fixture {
+  Fixture() {
+    std::filesystem::create_directories(root);
+    std::ofstream(device).write(std::vector<char>(2 * pageSize).data(), std::streamsize(2 * pageSize));
+    std::ofstream(sysfs / "uio0" / "name") << "ctkuiotest\n";
+    std::ofstream(sysfs / "uio0" / "event") << "0\n";
+    addMap(0, 0x80000000, 0x100);
+    addMap(1, 0x90000000, 0x200);
+  }
+
+  ~Fixture() { std::filesystem::remove_all(root); }
+
+  void addMap(size_t index, uint64_t addr, uint64_t size) const {
+    auto mapPath = sysfs / "uio0" / "maps" / ("map" + std::to_string(index));
+    std::filesystem::create_directories(mapPath);
+    std::ofstream(mapPath / "addr") << std::hex << "0x" << addr << "\n";
+    std::ofstream(mapPath / "size") << std::hex << "0x" << size << "\n";
+    std::ofstream(mapPath / "offset") << "0x0\n";
+  }
+
+  [[nodiscard]] int32_t readDevice(size_t map, size_t address) const {
+    int32_t value;
+    std::ifstream file(device);
+    file.seekg(std::streamoff(map * pageSize + address));
+    file.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+  }
+
+  size_t pageSize{static_cast<size_t>(sysconf(_SC_PAGESIZE))};
+  std::filesystem::path root{std::filesystem::temp_directory_path() / ("testUioAccess-" + std::to_string(getpid()))};
+  std::filesystem::path sysfs{root / "sys"};
+  std::filesystem::path device{root / "uio0"};
+};
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testNumberOfMaps, Fixture) {
+  // known from sysfs before opening
+  UioAccess uio(device.string(), sysfs);
+  BOOST_TEST(uio.getNumberOfMaps() == 2);
+
+  // the device can also be specified by its device tree node name
+  UioAccess byNodeName((root / "ctkuiotest").string(), sysfs);
+  BOOST_TEST(byNodeName.getNumberOfMaps() == 2);
+  BOOST_TEST(byNodeName.getDeviceFilePath() == device.string());
+
+  // not existing device
+  UioAccess missing((root / "uio7").string(), sysfs);
+  BOOST_TEST(missing.getNumberOfMaps() == 0);
+  BOOST_CHECK_THROW(missing.open(), ChimeraTK::runtime_error);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testMultiMapAccess, Fixture) {
+  UioAccess uio(device.string(), sysfs);
+  uio.open();
+
+  int32_t value = 42;
+  uio.write(0, 4, &value, sizeof(value));
+  value = -7;
+  uio.write(1, 8, &value, sizeof(value));
+  BOOST_TEST(readDevice(0, 4) == 42);
+  BOOST_TEST(readDevice(1, 8) == -7);
+
+  uio.read(0, 4, &value, sizeof(value));
+  BOOST_TEST(value == 42);
+  uio.read(1, 8, &value, sizeof(value));
+  BOOST_TEST(value == -7);
+
+  // absolute bus addresses are accepted as well
+  uio.read(1, 0x90000008, &value, sizeof(value));
+  BOOST_TEST(value == -7);
+
+  // accesses outside of the regions
+  BOOST_CHECK_THROW(uio.read(0, 0x100, &value, sizeof(value)), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(uio.write(1, 0x1FE, &value, sizeof(value)), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(uio.read(2, 0, &value, sizeof(value)), ChimeraTK::logic_error);
+
+  uio.close();
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testBackendBarIndex, Fixture) {
+  auto mapFile = (root / "uioAccessTest.map").string();
+  std::ofstream(mapFile) << "REG0 1 4 4 0 32 0 1 RW\n"
+                         << "REG1 1 8 4 1 32 0 1 RW\n"
+                         << "REG2 1 0 4 2 32 0 1 RW\n";
+
+  auto backend = boost::make_shared<UioBackend>(std::make_shared<UioAccess>(device.string(), sysfs), mapFile);
+
+  // invalid map indices are detected before opening the device
+  BOOST_TEST(backend->barIndexValid(0));
+  BOOST_TEST(backend->barIndexValid(1));
+  BOOST_TEST(!backend->barIndexValid(2));
+  BOOST_CHECK_THROW(std::ignore = backend->getRegisterAccessor<int32_t>("REG2", 0, 0, {}), ChimeraTK::logic_error);
+
+  auto reg1 = backend->getRegisterAccessor<int32_t>("REG1", 0, 0, {});
+  backend->open();
+  reg1->accessData(0) = 123;
+  reg1->write();
+  BOOST_TEST(readDevice(1, 8) == 123);
+  backend->close();
+}
+
+/**********************************************************************************************************************/
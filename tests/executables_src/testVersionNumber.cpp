@@ -26,6 +26,8 @@ class VersionNumberTest {
   void testThreadedCreation();
   void testStringConvert();
   void testTimeStamp();
+  void testCoarseClock();
+  void testBatch();
 
   VersionNumber v1;
   VersionNumber v2;
@@ -50,6 +52,8 @@ class VersionNumberTestSuite : public test_suite {
     add(BOOST_CLASS_TEST_CASE(&VersionNumberTest::testThreadedCreation, test));
     add(BOOST_CLASS_TEST_CASE(&VersionNumberTest::testStringConvert, test));
     add(BOOST_CLASS_TEST_CASE(&VersionNumberTest::testTimeStamp, test));
+    add(BOOST_CLASS_TEST_CASE(&VersionNumberTest::testCoarseClock, test));
+    add(BOOST_CLASS_TEST_CASE(&VersionNumberTest::testBatch, test));
   }
 };
 
@@ -332,3 +336,43 @@ void VersionNumberTest::testTimeStamp() {
   auto t1 = std::chrono::system_clock::now();
   BOOST_CHECK(vv2.getTime() < t1);
 }
+
+void VersionNumberTest::testCoarseClock() {
+  BOOST_CHECK(VersionNumber::getClock() == VersionNumber::Clock::precise);
+  VersionNumber::setClock(VersionNumber::Clock::coarse);
+  BOOST_CHECK(VersionNumber::getClock() == VersionNumber::Clock::coarse);
+
+  // the coarse clock lags behind by at most a few kernel ticks
+  auto t0 = std::chrono::system_clock::now();
+  VersionNumber vv0;
+  BOOST_CHECK(vv0.getTime() <= std::chrono::system_clock::now());
+  BOOST_CHECK(vv0.getTime() > t0 - std::chrono::milliseconds(100));
+  VersionNumber vv1;
+  BOOST_CHECK(vv1 > vv0);
+  BOOST_CHECK(vv1.getTime() >= vv0.getTime());
+
+  VersionNumber::setClock(VersionNumber::Clock::precise);
+}
+
+void VersionNumberTest::testBatch() {
+  VersionNumber before;
+  auto timestamp = std::chrono::system_clock::now() - std::chrono::hours(1);
+  VersionNumber::Batch batch(3, timestamp);
+  VersionNumber after;
+  BOOST_CHECK_EQUAL(batch.remaining(), 3);
+
+  auto vb0 = batch.next();
+  auto vb1 = batch.next();
+  auto vb2 = batch.next();
+  BOOST_CHECK_EQUAL(batch.remaining(), 0);
+
+  // all version numbers are unique and ordered, and the batch was reserved in one go
+  BOOST_CHECK(vb0 > before);
+  BOOST_CHECK(vb1 > vb0);
+  BOOST_CHECK(vb2 > vb1);
+  BOOST_CHECK(after > vb2);
+
+  BOOST_CHECK(vb0.getTime() == timestamp);
+  BOOST_CHECK(vb1.getTime() == timestamp);
+  BOOST_CHECK(vb2.getTime() == timestamp);
+}
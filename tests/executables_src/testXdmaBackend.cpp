@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE XdmaBackendTest
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "XdmaBackend.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+// Ordinary files are used as stand-in for the XDMA device files. Each DMA channel gets its own file, so the test can
+// tell which channel a word has been read through: word i of channel c contains (c << 24) | i.
+struct Fixture {
+  static constexpr size_t nChannels = 4;
+  static constexpr size_t nWords = 64 * 1024;
+
+  Fixture() {
+    std::filesystem::create_directories(path);
+    std::ofstream(path / "user").write(std::vector<char>(4096).data(), 4096);
+    for(size_t c = 0; c < nChannels; ++c) {
+      std::vector<int32_t> content(nWords);
+      for(size_t i = 0; i < nWords; ++i) {
+        content[i] = expectedWord(c, i);
+      }
+      std::ofstream(path / ("c2h" + std::to_string(c)))
+          .write(reinterpret_cast<const char*>(content.data()), nWords * sizeof(int32_t));
+      std::ofstream(path / ("h2c" + std::to_string(c)));
+    }
+  }
+
+  ~Fixture() { std::filesystem::remove_all(path); }
+
+  static int32_t expectedWord(size_t channel, size_t index) { return int32_t((channel << 24) | index); }
+
+  std::filesystem::path path{
+      std::filesystem::temp_directory_path() / ("testXdmaBackend-" + std::to_string(getpid()))};
+};
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testSplitRead, Fixture) {
+  XdmaBackend backend(path.string(), "", "", 4096);
+  backend.open();
+
+  // 64 kiB are split into 4 parts of 16 kiB, one per channel
+  std::vector<int32_t> buffer(16 * 1024);
+  backend.read(13, 0, buffer.data(), buffer.size() * sizeof(int32_t));
+  for(size_t i = 0; i < buffer.size(); ++i) {
+    BOOST_TEST_REQUIRE(buffer[i] == expectedWord(i / 4096, i));
+  }
+
+  // small reads are not split and use the channel given by the BAR
+  std::vector<int32_t> small(1024);
+  backend.read(14, 4096, small.data(), small.size() * sizeof(int32_t));
+  for(size_t i = 0; i < small.size(); ++i) {
+    BOOST_TEST_REQUIRE(small[i] == expectedWord(1, 1024 + i));
+  }
+
+  backend.close();
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testSplitDisabled, Fixture) {
+  XdmaBackend backend(path.string());
+  backend.open();
+
+  std::vector<int32_t> buffer(16 * 1024);
+  backend.read(13, 0, buffer.data(), buffer.size() * sizeof(int32_t));
+  for(size_t i = 0; i < buffer.size(); ++i) {
+    BOOST_TEST_REQUIRE(buffer[i] == expectedWord(0, i));
+  }
+
+  backend.close();
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testAnnouncedReads, Fixture) {
+  XdmaBackend backend(path.string(), "", "", 4096);
+  backend.open();
+
+  int owner1, owner2, owner3;
+  std::vector<int32_t> buffer1(1024), buffer2(1024), buffer3(8 * 1024);
+  backend.announceRead(&owner1, 13, 0, buffer1.data(), buffer1.size() * sizeof(int32_t));
+  backend.announceRead(&owner2, 13, 8192, buffer2.data(), buffer2.size() * sizeof(int32_t));
+  backend.announceRead(&owner3, 13, 65536, buffer3.data(), buffer3.size() * sizeof(int32_t));
+
+  // executing the second read executes all of them, distributed round robin over the channels. The third read is
+  // split into 4 parts of 8 kiB.
+  backend.read(13, 8192, buffer2.data(), buffer2.size() * sizeof(int32_t));
+  for(size_t i = 0; i < buffer1.size(); ++i) {
+    BOOST_TEST_REQUIRE(buffer1[i] == expectedWord(0, i));
+    BOOST_TEST_REQUIRE(buffer2[i] == expectedWord(1, 2048 + i));
+  }
+  for(size_t i = 0; i < buffer3.size(); ++i) {
+    BOOST_TEST_REQUIRE(buffer3[i] == expectedWord((2 + i / 2048) % 4, 16384 + i));
+  }
+
+  // the other reads are already done
+  std::ranges::fill(buffer1, 0);
+  backend.read(13, 0, buffer1.data(), buffer1.size() * sizeof(int32_t));
+  BOOST_TEST(buffer1[0] == 0);
+
+  backend.withdrawTransfers(&owner1);
+  backend.withdrawTransfers(&owner2);
+  backend.withdrawTransfers(&owner3);
+
+  // after withdrawing, reads are executed normally again
+  backend.read(13, 0, buffer1.data(), buffer1.size() * sizeof(int32_t));
+  BOOST_TEST(buffer1[1] == expectedWord(0, 1));
+
+  backend.close();
+}
+
+/**********************************************************************************************************************/
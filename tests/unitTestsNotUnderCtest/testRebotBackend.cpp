@@ -11,6 +11,7 @@
 #include "DMapFileParser.h"
 #include "NumericAddress.h"
 #include "RebotBackend.h"
+#include "TransferGroup.h"
 #include "Utilities.h"
 
 namespace ChimeraTK {
@@ -39,6 +40,7 @@ class RebotTestClass {
   explicit RebotTestClass(std::string const& cardAlias);
   void testConnection();
   void testReadWriteAPIOfRebotBackend();
+  void testPipelinedTransfers();
 
  private:
   /*
@@ -60,6 +62,7 @@ class RebotDeviceTestSuite : public test_suite {
     boost::shared_ptr<RebotTestClass> rebotTest(new RebotTestClass(cardAlias));
     add(BOOST_CLASS_TEST_CASE(&RebotTestClass::testConnection, rebotTest));
     add(BOOST_CLASS_TEST_CASE(&RebotTestClass::testReadWriteAPIOfRebotBackend, rebotTest));
+    add(BOOST_CLASS_TEST_CASE(&RebotTestClass::testPipelinedTransfers, rebotTest));
   }
 };
 
@@ -178,3 +181,58 @@ void RebotTestClass::testReadWriteAPIOfRebotBackend() {
     BOOST_CHECK_EQUAL(test_area_data[i], test_area_ReadIndata[i]);
   }
 }
+
+void RebotTestClass::testPipelinedTransfers() {
+  ChimeraTK::Device device("(rebot?ip=" + _rebotServer.ip + "&port=" + _rebotServer.port +
+      "&map=mtcadummy_rebot.map&requestWindow=8)");
+  device.open();
+
+  // The registers are not adjacent, so the TransferGroup contains three low-level transfers. They are all executed
+  // together, with the requests sent back to back. The test area needs several read commands in protocol version 0.
+  // This test only checks the data, since it must also run with real hardware. That the requests are actually in flight
+  // together is checked against the dummy server in testRebotRequestWindow.
+  auto status = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_STATUS");
+  auto clockCount = device.getScalarRegisterAccessor<int32_t>("ADC.WORD_CLK_CNT_1");
+  auto testArea = device.getOneDRegisterAccessor<int32_t>("ADC.TEST_AREA");
+
+  ChimeraTK::TransferGroup group;
+  group.addAccessor(status);
+  group.addAccessor(clockCount);
+  group.addAccessor(testArea);
+
+  status = 17;
+  clockCount = -42;
+  for(size_t i = 0; i < testArea.getNElements(); ++i) {
+    testArea[i] = static_cast<int32_t>(3 * i + 1);
+  }
+  group.write();
+
+  // check with individual accessors outside the group
+  auto status2 = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_STATUS");
+  auto clockCount2 = device.getScalarRegisterAccessor<int32_t>("ADC.WORD_CLK_CNT_1");
+  auto testArea2 = device.getOneDRegisterAccessor<int32_t>("ADC.TEST_AREA");
+  status2.read();
+  clockCount2.read();
+  testArea2.read();
+  BOOST_CHECK_EQUAL(int32_t(status2), 17);
+  BOOST_CHECK_EQUAL(int32_t(clockCount2), -42);
+  for(size_t i = 0; i < testArea2.getNElements(); ++i) {
+    BOOST_CHECK_EQUAL(testArea2[i], static_cast<int32_t>(3 * i + 1));
+  }
+
+  // change the values individually and read them back through the group
+  status2.setAndWrite(23);
+  clockCount2.setAndWrite(5);
+  for(size_t i = 0; i < testArea2.getNElements(); ++i) {
+    testArea2[i] = static_cast<int32_t>(1000 - i);
+  }
+  testArea2.write();
+
+  group.read();
+  BOOST_CHECK_EQUAL(int32_t(status), 23);
+  BOOST_CHECK_EQUAL(int32_t(clockCount), 5);
+  for(size_t i = 0; i < testArea.getNElements(); ++i) {
+    BOOST_CHECK_EQUAL(testArea[i], static_cast<int32_t>(1000 - i));
+  }
+  device.close();
+}